@@ -1,23 +1,170 @@
+#!/usr/bin/env python3
+"""
+Convert the splash logo into a palette + RLE compressed RGB565 asset.
+
+Runs standalone (python convert_img.py) or as a PlatformIO pre-build script
+(extra_scripts in platformio.ini), in which case it only regenerates the
+header when the hash of the PNG and this script differs from the one recorded
+in it. File times are not used: a fresh checkout or a touched PNG must not
+rewrite (and dirty) the committed header.
+
+Stream format (decoded by src/ImageStream.cpp):
+  token & 0x80 -> run:     (token & 0x7F) + 1 pixels of palette[next byte]
+  otherwise    -> literal: token + 1 palette indices follow
+"""
+
+import hashlib
 import os
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+    as_build_step = True
+except NameError:
+    project_dir = os.path.dirname(os.path.abspath(__file__))
+    as_build_step = False
+
+input_file = os.path.join(project_dir, 'download.png')
+output_file = os.path.join(project_dir, 'src', 'logo_image.h')
+asset_name = 'gspro_logo'
+background = (0, 0, 0)  # Splash background, transparent pixels are blended onto it
+
+MAX_RUN = 128
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def load_indexed(path):
+    """Return (width, height, palette565, indices) with at most 256 colors"""
+    from PIL import Image
+
+    img = Image.open(path).convert('RGBA')
+    flat = Image.new('RGBA', img.size, background + (255,))
+    flat.alpha_composite(img)
+    rgb = flat.convert('RGB')
+
+    raw = rgb.tobytes()
+    colors = [rgb565(raw[i], raw[i + 1], raw[i + 2]) for i in range(0, len(raw), 3)]
+    palette = sorted(set(colors))
+    if len(palette) > 256:
+        quant = rgb.quantize(colors=256)
+        pal = quant.getpalette()
+        palette = [rgb565(pal[i * 3], pal[i * 3 + 1], pal[i * 3 + 2]) for i in range(256)]
+        return img.width, img.height, palette, list(quant.tobytes())
+
+    lookup = {c: i for i, c in enumerate(palette)}
+    return img.width, img.height, palette, [lookup[c] for c in colors]
+
+
+def rle_encode(indices):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < MAX_RUN:
+            run += 1
+        if run >= 3:  # A run token costs 2 bytes, only worth it from 3 pixels on
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+        else:
+            literal.extend(indices[i:i + run])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+HASH_PREFIX = '// Source hash: '
+
+
+def source_hash():
+    """sha1 over the PNG and this script, so a converter change also regenerates"""
+    h = hashlib.sha1()
+    for path in (input_file, os.path.join(project_dir, 'convert_img.py')):
+        with open(path, 'rb') as f:
+            h.update(f.read())
+    return h.hexdigest()
+
+
+def recorded_hash():
+    try:
+        with open(output_file) as f:
+            for _ in range(3):
+                line = f.readline()
+                if line.startswith(HASH_PREFIX):
+                    return line[len(HASH_PREFIX):].strip()
+    except OSError:
+        pass
+    return None
+
+
+def write_header(width, height, palette, data):
+    with open(output_file, 'w') as f:
+        f.write('// Generated by convert_img.py from download.png - do not edit\n')
+        f.write(f'{HASH_PREFIX}{source_hash()}\n')
+        f.write('#include <pgmspace.h>\n')
+        f.write('#include "ImageStream.h"\n\n')
+
+        f.write(f'const uint16_t {asset_name}_palette[{len(palette)}] PROGMEM = {{\n')
+        for i, c in enumerate(palette):
+            if i % 12 == 0:
+                f.write('  ')
+            f.write(f'0x{c:04X}, ')
+            if (i + 1) % 12 == 0:
+                f.write('\n')
+        f.write('\n};\n\n')
+
+        f.write(f'const uint8_t {asset_name}_rle[{len(data)}] PROGMEM = {{\n')
+        for i, byte in enumerate(data):
+            if i % 16 == 0:
+                f.write('  ')
+            f.write(f'0x{byte:02X}, ')
+            if (i + 1) % 16 == 0:
+                f.write('\n')
+        f.write('\n};\n\n')
+
+        f.write(f'const RleImage {asset_name} = {{ {width}, {height}, {len(palette)}, '
+                f'{asset_name}_palette, {asset_name}_rle, {len(data)} }};\n')
+
+
+def convert():
+    width, height, palette, indices = load_indexed(input_file)
+    data = rle_encode(indices)
+    write_header(width, height, palette, data)
+
+    png_size = os.path.getsize(input_file)
+    raw_size = width * height * 2
+    asset_size = len(data) + len(palette) * 2
+    print(f"Converted {input_file} to {output_file}")
+    print(f"  {width}x{height}, {len(palette)} colors")
+    print(f"  PNG:        {png_size:7d} bytes")
+    print(f"  Raw RGB565: {raw_size:7d} bytes")
+    print(f"  RLE+palette:{asset_size:7d} bytes ({asset_size * 100 // raw_size}% of raw)")
+
+
+def needs_update():
+    return recorded_hash() != source_hash()
+
 
-input_file = 'download.png'
-output_file = 'src/logo_image.h'
-
-with open(input_file, 'rb') as f:
-    data = f.read()
-
-with open(output_file, 'w') as f:
-    f.write('#include <pgmspace.h>\n\n')
-    f.write('const uint8_t gspro_logo[] PROGMEM = {\n')
-    
-    for i, byte in enumerate(data):
-        if i % 16 == 0:
-            f.write('  ')
-        f.write(f'0x{byte:02X}, ')
-        if (i + 1) % 16 == 0:
-            f.write('\n')
-            
-    f.write('\n};\n\n')
-    f.write(f'const uint32_t gspro_logo_len = {len(data)};\n')
-
-print(f"Converted {input_file} to {output_file}")
+if not as_build_step:
+    convert()
+elif needs_update():
+    try:
+        convert()
+    except ImportError:
+        # Pillow is missing from the PlatformIO Python; keep the committed header
+        if not os.path.exists(output_file):
+            sys.exit("convert_img.py: Pillow is required to generate src/logo_image.h (pip install Pillow)")
+        print("convert_img.py: Pillow not installed, using existing src/logo_image.h")
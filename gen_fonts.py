@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+"""
+Generate glyph-subset LVGL fonts for the controller UI.
+
+Runs as a PlatformIO pre-build script (extra_scripts in platformio.ini) or
+standalone. Only text that can reach the screen is scanned: string literals
+passed to lv_label_set_text*(), set_status*() and create_custom_btn(),
+string variables passed to them by name, KeyMap labels and transport names.
+Each font size below is rasterized by lv_font_conv with only those
+characters (plus digits and the punctuation used by formatted status text)
+into src/fonts/. Prints a flash-usage report per font.
+
+If lv_font_conv (Node.js) is unavailable, or GSPRO_BUILTIN_FONT=1 is set,
+the build falls back to LVGL's built-in Montserrat 14 and removes any fonts
+left in src/fonts/ by an earlier run, so stale sources are never compiled.
+A missing font source is an error, not a fallback.
+
+The LVGL font settings for the subset fonts (LV_FONT_DEFAULT is a pointer
+expression, LV_FONT_CUSTOM_DECLARE a macro call) are written to
+src/fonts/gspro_fonts_conf.h and force-included with -include rather than
+passed as -D values, which would reach the shell unquoted.
+
+Font sources are looked up in fonts/ and then in LVGL's scripts/built_in_font/
+inside .pio/libdeps. Set GSPRO_FONT_DIR to override.
+"""
+
+import glob
+import hashlib
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+    libdeps_dir = env.subst("$PROJECT_LIBDEPS_DIR")  # noqa: F821
+    as_build_step = True
+except NameError:
+    project_dir = os.path.dirname(os.path.abspath(__file__))
+    libdeps_dir = os.path.join(project_dir, '.pio', 'libdeps')
+    as_build_step = False
+
+src_dir = os.path.join(project_dir, 'src')
+out_dir = os.path.join(src_dir, 'fonts')
+stamp_file = os.path.join(out_dir, 'fonts.stamp')
+conf_header = os.path.join(out_dir, 'gspro_fonts_conf.h')
+
+LV_FONT_CONV = 'lv_font_conv@1.5.2'
+TEXT_FONT = 'Montserrat-Medium.ttf'
+SYMBOL_FONT = 'FontAwesome5-Solid+Brands+Regular.woff'
+
+# (LVGL font name, pixel size) - see src/Fonts.h for where each is used
+FONTS = [
+    ('gspro_font_14', 14),  # Status text, hints, splash subtitle, header buttons
+    ('gspro_font_18', 18),  # Action and navigation buttons
+    ('gspro_font_24', 24),  # Header logo text
+]
+
+# Characters that appear only through printf formatting (IP addresses, counters)
+ALWAYS_INCLUDE = '0123456789.:%-/()+ '
+
+# LV_SYMBOL_* macros that may appear next to string literals
+SYMBOLS = {
+    'LEFT': 0xF053, 'RIGHT': 0xF054, 'UP': 0xF077, 'DOWN': 0xF078,
+    'OK': 0xF00C, 'CLOSE': 0xF00D, 'WIFI': 0xF1EB, 'REFRESH': 0xF021,
+    'SETTINGS': 0xF013, 'HOME': 0xF015, 'WARNING': 0xF071,
+}
+
+GENERATED = ('logo_image.h',)
+LITERAL = r'"((?:[^"\\\n]|\\.)*)"'
+STRING_RE = re.compile(LITERAL)
+SYMBOL_RE = re.compile(r'LV_SYMBOL_(\w+)')
+# Calls whose text arguments end up in a label
+UI_CALL_RE = re.compile(r'\b(?:lv_label_set_text\w*|set_status\w*|create_custom_btn)\s*\(')
+IDENT_RE = re.compile(r'\b[A-Za-z_]\w*\b')
+# Label text that reaches the UI through a pointer: KeyMap labels ("Sent: %s"), transport names
+INDIRECT_RE = [
+    re.compile(r'KeyMap\s+\w+\s*=\s*\{\s*' + LITERAL),
+    re.compile(r'name\(\)\s*const\s*override\s*\{\s*return\s*' + LITERAL),
+]
+PRINTF_SPEC_RE = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z)?[diouxXcsf%]')
+
+
+def call_args(text, start):
+    """Argument text of the call whose '(' is at text[start - 1], up to the matching ')'"""
+    depth = 1
+    i = start
+    while i < len(text) and depth:
+        c = text[i]
+        if c == '"':
+            m = STRING_RE.match(text, i)
+            i = m.end() if m else i + 1
+            continue
+        depth += {'(': 1, ')': -1}.get(c, 0)
+        i += 1
+    return text[start:i - 1]
+
+
+def ui_literals(text):
+    """String literals that can be displayed: UI call arguments, variables passed to them, indirect labels"""
+    literals = []
+    for call in UI_CALL_RE.finditer(text):
+        args = call_args(text, call.end())
+        literals += [PRINTF_SPEC_RE.sub('', s) for s in STRING_RE.findall(args)]
+        # e.g. set_status(disconnected) with `const char *const disconnected = "..."`
+        for name in set(IDENT_RE.findall(STRING_RE.sub('', args))):
+            literals += re.findall(r'\b' + name + r'\s*=\s*' + LITERAL, text)
+    for pattern in INDIRECT_RE:
+        literals += pattern.findall(text)
+    return literals
+
+
+def scan_sources():
+    """Return (characters, symbol codepoints) of the UI text in src/"""
+    chars = set(ALWAYS_INCLUDE)
+    symbols = set()
+    for path in glob.glob(os.path.join(src_dir, '*.[ch]*')):
+        if os.path.basename(path) in GENERATED:
+            continue
+        with open(path, encoding='utf-8', errors='ignore') as f:
+            text = f.read()
+        for literal in ui_literals(text):
+            cleaned = re.sub(r'\\.', '', literal)
+            chars.update(c for c in cleaned if 0x20 <= ord(c) < 0x7F)
+        for name in SYMBOL_RE.findall(text):
+            if name in SYMBOLS:
+                symbols.add(SYMBOLS[name])
+    return ''.join(sorted(chars)), sorted(symbols)
+
+
+def font_dirs():
+    """Directories searched for font sources, in order"""
+    dirs = [os.environ.get('GSPRO_FONT_DIR', ''), os.path.join(project_dir, 'fonts')]
+    dirs += glob.glob(os.path.join(libdeps_dir, '*', 'lvgl', 'scripts', 'built_in_font'))
+    return [d for d in dirs if d]
+
+
+def find_font(name):
+    for d in font_dirs():
+        path = os.path.join(d, name)
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def fail(message):
+    """Stop the build (or the standalone run) with an error instead of falling back"""
+    print(f"gen_fonts.py: error: {message}", file=sys.stderr)
+    if as_build_step:
+        env.Exit(1)  # noqa: F821
+    sys.exit(1)
+
+
+def font_report(path, name):
+    """Approximate flash footprint of a generated font from its C source"""
+    with open(path) as f:
+        text = f.read()
+    bitmap = re.search(r'glyph_bitmap\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    bitmap_bytes = bitmap.group(1).count('0x') if bitmap else 0
+    glyphs = len(re.findall(r'\{\.bitmap_index', text))
+    dsc_bytes = glyphs * 8  # sizeof(lv_font_fmt_txt_glyph_dsc_t)
+    total = bitmap_bytes + dsc_bytes
+    print(f"  {name:16s} {glyphs:4d} glyphs  bitmap {bitmap_bytes:6d} B  dsc {dsc_bytes:5d} B  ~{total / 1024:5.1f} KB")
+    return total
+
+
+CONF_HEADER = """\
+// Generated by gen_fonts.py, force-included (-include) into every translation unit
+#ifndef GSPRO_FONTS_CONF_H
+#define GSPRO_FONTS_CONF_H
+
+#define GSPRO_FONTS 1
+// The 14 px subset replaces Montserrat 14 as LVGL's default, so the built-in one is dropped
+#define LV_FONT_MONTSERRAT_14 0
+#define LV_FONT_DEFAULT &gspro_font_14
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(gspro_font_14)
+
+#endif
+"""
+
+
+def write_conf_header():
+    """Write the -include header, leaving it untouched when unchanged"""
+    if os.path.exists(conf_header):
+        with open(conf_header) as f:
+            if f.read() == CONF_HEADER:
+                return
+    with open(conf_header, 'w') as f:
+        f.write(CONF_HEADER)
+
+
+def remove_generated():
+    """Delete src/fonts/*.c, the stamp and the conf header; without GSPRO_FONTS they would still be built"""
+    stale = glob.glob(os.path.join(out_dir, '*.c'))
+    for path in stale + [stamp_file, conf_header]:
+        if os.path.exists(path):
+            os.remove(path)
+    if stale:
+        print(f"gen_fonts.py: removed {len(stale)} stale generated font(s) from src/fonts/")
+
+
+def generate():
+    """Generate all fonts if needed; return True when the subset fonts are usable"""
+    chars, symbols = scan_sources()
+    text_font = find_font(TEXT_FONT)
+    symbol_font = find_font(SYMBOL_FONT)
+    outputs = [os.path.join(out_dir, f'{name}.c') for name, _ in FONTS]
+
+    key = hashlib.sha1(repr((FONTS, chars, symbols, LV_FONT_CONV)).encode()).hexdigest()
+    if all(os.path.exists(p) for p in outputs) and os.path.exists(stamp_file):
+        with open(stamp_file) as f:
+            if f.read().strip() == key:
+                return True
+
+    npx = shutil.which('npx')
+    if os.environ.get('GSPRO_BUILTIN_FONT') == '1' or not npx:
+        reason = 'GSPRO_BUILTIN_FONT=1' if npx else 'npx (Node.js) not found'
+        print(f"gen_fonts.py: {reason}, using built-in Montserrat 14")
+        remove_generated()
+        return False
+    if not text_font or (symbols and not symbol_font):
+        missing = TEXT_FONT if not text_font else SYMBOL_FONT
+        lvgl_dir = os.path.join(libdeps_dir, '<env>', 'lvgl', 'scripts', 'built_in_font')
+        searched = '\n  '.join(font_dirs() or ['(none exist)'])
+        fail(f"{missing} not found. Searched:\n  {searched}\n"
+             f"LVGL's font sources are expected in {lvgl_dir}; if this LVGL package does not ship them, "
+             f"copy {TEXT_FONT} and {SYMBOL_FONT} into fonts/ or point GSPRO_FONT_DIR at them, "
+             f"or set GSPRO_BUILTIN_FONT=1 to build with the built-in Montserrat 14")
+
+    os.makedirs(out_dir, exist_ok=True)
+    print(f"gen_fonts.py: {len(chars)} characters, {len(symbols)} symbols")
+    total = 0
+    for (name, size), out in zip(FONTS, outputs):
+        cmd = [npx, '--yes', LV_FONT_CONV, '--no-compress', '--format', 'lvgl', '--bpp', '4',
+               '--size', str(size), '--lv-include', 'lvgl.h', '-o', out,
+               '--font', text_font, '--symbols', chars]
+        if symbols:
+            cmd += ['--font', symbol_font, '--range', ','.join(hex(s) for s in symbols)]
+        if subprocess.call(cmd) != 0:
+            print(f"gen_fonts.py: lv_font_conv failed for {name}, using built-in Montserrat 14")
+            remove_generated()
+            return False
+        total += font_report(out, name)
+    print(f"  {'total':16s} ~{total / 1024:5.1f} KB flash")
+
+    with open(stamp_file, 'w') as f:
+        f.write(key + '\n')
+    return True
+
+
+ok = generate()
+
+if as_build_step:
+    if ok:
+        write_conf_header()
+        # CCFLAGS reach both C (LVGL, the fonts) and C++; one list item per argument
+        env.Append(CCFLAGS=['-include', conf_header])  # noqa: F821
+    else:
+        env.Append(CPPDEFINES=[('LV_FONT_MONTSERRAT_14', 1)])  # noqa: F821
+elif not ok:
+    sys.exit(1)
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+GSPRO Controller latency tracking, shared by both receivers.
+
+Answers controller pings (command 10) with pongs (command 11) and turns the
+4-byte timestamp trailer on every other command into a one-way latency, using
+the clock offset the controller sends with each ping (NTP-style estimate).
+Offsets older than OFFSET_MAX_AGE_S are not used: after an idle spell without
+pings, crystal drift makes them wrong by milliseconds.
+"""
+
+import collections
+import struct
+import threading
+import time
+
+CMD_NOP = 0  # Benchmark filler, never injected
+CMD_PING = 10
+CMD_PONG = 11
+TIMESTAMP_LEN = 4
+OFFSET_MAX_AGE_S = 5.0
+
+# Payload bytes after the command byte; the timestamp trailer follows them
+PAYLOAD_LEN = {1: 1, 2: 1, 3: 1, 4: 2, 5: 1, 6: 1, 7: 1, 8: 2, 9: 4}
+
+
+def now_us():
+    """Receiver clock in microseconds, wrapping at 2^32 like the controller's micros()"""
+    return (time.perf_counter_ns() // 1000) & 0xFFFFFFFF
+
+
+def percentile(sorted_values, pct):
+    return sorted_values[(len(sorted_values) - 1) * pct // 100]
+
+
+class LatencyTracker:
+    """Per-client clock offsets and a rolling window of one-way latencies"""
+
+    WINDOW = 512
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.offsets = {}   # client -> (offset, time.monotonic() when received)
+        self.one_way = collections.deque(maxlen=self.WINDOW)
+        self.pings = 0
+        self.stale = 0      # Packets skipped because the offset was too old
+
+    def handle_ping(self, client, data, recv_us):
+        """Return the pong to send back for a ping packet, or None if malformed"""
+        if len(data) < 12:
+            return None
+        seq, t1, offset, synced = struct.unpack('>HIIB', bytes(data[1:12]))
+        with self.lock:
+            self.pings += 1
+            if synced:
+                self.offsets[client] = (offset, time.monotonic())
+        t3 = now_us()
+        return bytes([CMD_PONG]) + struct.pack('>HIII', seq, t1, recv_us, t3)
+
+    def note_packet(self, client, data, recv_us):
+        """Record the one-way latency of a data packet that carries a timestamp trailer"""
+        payload_len = PAYLOAD_LEN.get(data[0])
+        if payload_len is None or len(data) < 1 + payload_len + TIMESTAMP_LEN:
+            return
+        entry = self.offsets.get(client)
+        if entry is None:
+            return  # No ping from this controller yet
+        offset, received = entry
+        if time.monotonic() - received > OFFSET_MAX_AGE_S:
+            with self.lock:
+                self.stale += 1
+            return
+
+        start = 1 + payload_len
+        sent_us = struct.unpack('>I', bytes(data[start:start + TIMESTAMP_LEN]))[0]
+        delay = (recv_us - sent_us - offset) & 0xFFFFFFFF
+        if delay >= 0x80000000:
+            delay -= 0x100000000  # Offset error can make very short paths slightly negative
+        with self.lock:
+            self.one_way.append(delay)
+
+    def summary(self):
+        """(p50, p95, p99, samples) of one-way latency in microseconds, or None"""
+        with self.lock:
+            values = sorted(self.one_way)
+        if not values:
+            return None
+        return percentile(values, 50), percentile(values, 95), percentile(values, 99), len(values)
+
+    def summary_text(self):
+        s = self.summary()
+        if s is None:
+            return "One-way latency: no samples"
+        p50, p95, p99, n = s
+        return (f"One-way latency p50/p95/p99: {p50 / 1000:.1f} / {p95 / 1000:.1f} / {p99 / 1000:.1f} ms "
+                f"({n} packets, {self.stale} skipped with a stale offset)")
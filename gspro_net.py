@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+GSPRO Controller networking and screen helpers, shared by both receivers.
+
+The TCP listener accepts controllers alongside the UDP socket and unpacks the
+stream into [len][cmd][payload...] frames, handing each one to the receiver's
+frame handler with its receive time and a reply callback (for pongs). The
+monitor rectangles map the touchpad's tablet mode onto a screen.
+"""
+
+import socket
+import threading
+import time
+
+from gspro_latency import now_us
+
+ACCEPT_TIMEOUT_S = 1.0  # How often the listener and clients check running()
+MONITOR_CACHE_S = 10
+
+_monitor_cache = {'rects': None, 'time': 0}
+
+
+def recv_exact(conn, n):
+    """Read exactly n bytes from a TCP connection, None on disconnect"""
+    buf = b''
+    while len(buf) < n:
+        chunk = conn.recv(n - len(buf))
+        if not chunk:
+            return None
+        buf += chunk
+    return buf
+
+
+def tcp_client(conn, addr, on_frame, running=lambda: True):
+    """Handle one TCP controller: on_frame(frame, addr, recv_us, reply) for every frame"""
+    print(f"TCP controller connected: {addr[0]}")
+    conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    conn.settimeout(ACCEPT_TIMEOUT_S)
+    reply = lambda pong: conn.sendall(bytes([len(pong)]) + pong)
+    try:
+        while running():
+            try:
+                header = recv_exact(conn, 1)
+            except socket.timeout:
+                continue
+            if header is None:
+                break
+            conn.settimeout(None)  # Never split a frame on timeout
+            frame = recv_exact(conn, header[0])
+            conn.settimeout(ACCEPT_TIMEOUT_S)
+            if frame is None:
+                break
+            on_frame(frame, addr, now_us(), reply)
+    except OSError as e:
+        if running():
+            print(f"TCP error from {addr[0]}: {e}")
+    finally:
+        conn.close()
+        print(f"TCP controller disconnected: {addr[0]}")
+
+
+def tcp_server(host, port, on_frame, running=lambda: True):
+    """Accept TCP controllers until running() turns false, one thread per connection"""
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.settimeout(ACCEPT_TIMEOUT_S)
+    server.bind((host, port))
+    server.listen(4)
+
+    while running():
+        try:
+            conn, addr = server.accept()
+        except socket.timeout:
+            continue
+        except OSError as e:
+            if running():
+                print(f"Error: {e}")
+            continue
+        threading.Thread(target=tcp_client, args=(conn, addr, on_frame, running), daemon=True).start()
+
+    server.close()
+
+
+def get_monitor_rects():
+    """Monitor rectangles (left, top, width, height), primary first; cached for 10 s"""
+    now = time.time()
+    if _monitor_cache['rects'] and now - _monitor_cache['time'] < MONITOR_CACHE_S:
+        return _monitor_cache['rects']
+
+    rects = []
+    try:
+        import ctypes
+        from ctypes import wintypes
+
+        class MONITORINFO(ctypes.Structure):
+            _fields_ = [('cbSize', wintypes.DWORD), ('rcMonitor', wintypes.RECT),
+                        ('rcWork', wintypes.RECT), ('dwFlags', wintypes.DWORD)]
+
+        user32 = ctypes.windll.user32
+        MonitorEnumProc = ctypes.WINFUNCTYPE(ctypes.c_int, wintypes.HMONITOR, wintypes.HDC,
+                                             ctypes.POINTER(wintypes.RECT), wintypes.LPARAM)
+
+        def on_monitor(hmon, hdc, lprect, lparam):
+            info = MONITORINFO()
+            info.cbSize = ctypes.sizeof(MONITORINFO)
+            user32.GetMonitorInfoW(hmon, ctypes.byref(info))
+            r = info.rcMonitor
+            rect = (r.left, r.top, r.right - r.left, r.bottom - r.top)
+            if info.dwFlags & 1:  # MONITORINFOF_PRIMARY
+                rects.insert(0, rect)
+            else:
+                rects.append(rect)
+            return 1
+
+        user32.EnumDisplayMonitors(None, None, MonitorEnumProc(on_monitor), 0)
+    except Exception:
+        pass
+
+    if not rects:
+        rects = [(0, 0, 1920, 1080)]
+    _monitor_cache['rects'] = rects
+    _monitor_cache['time'] = now
+    return rects
@@ -6,16 +6,32 @@ Receives keyboard and mouse commands from ESP32 over UDP and simulates input on
 
 import socket
 import struct
+import threading
+import time
 from pynput.keyboard import Controller as KeyboardController, Key
 from pynput.mouse import Controller as MouseController, Button
+from gspro_latency import LatencyTracker, CMD_NOP, CMD_PING, now_us
+from gspro_scheduler import InjectionScheduler
+from gspro_net import get_monitor_rects, tcp_server
 
 # Configuration
 UDP_IP = "0.0.0.0"  # Listen on all interfaces
 UDP_PORT = 5006  # Changed from 5005 due to Windows Media Player conflict
+TCP_PORT = 5006  # Length-prefixed frames for networks that drop UDP
+TABLET_MONITOR = 0  # Monitor the touchpad's tablet mode maps onto (0 = primary)
+MOTION_DEADLINE_MS = 50  # Mouse motion still queued after this long is dropped, not injected late
 
 # Initialize controllers
 keyboard = KeyboardController()
 mouse = MouseController()
+latency = LatencyTracker()
+
+# Absolute positions are physical pixels; without this, Windows scaling shifts the cursor
+try:
+    import ctypes
+    ctypes.windll.shcore.SetProcessDpiAwareness(2)  # Per-monitor DPI aware
+except Exception:
+    pass
 
 # Key mapping (matches ESP32 side)
 KEY_MAP = {
@@ -62,6 +78,13 @@ def handle_mouse_move(dx, dy):
     mouse.position = (current_x + dx, current_y + dy)
     print(f"Mouse move: dx={dx}, dy={dy}")
 
+def handle_mouse_absolute(x, y):
+    """Handle absolute mouse position (0..65535 across the tablet monitor)"""
+    rects = get_monitor_rects()
+    left, top, width, height = rects[TABLET_MONITOR] if TABLET_MONITOR < len(rects) else rects[0]
+    mouse.position = (left + x * (width - 1) // 65535, top + y * (height - 1) // 65535)
+    print(f"Mouse absolute: x={x}, y={y}")
+
 def handle_mouse_click(button_code):
     """Handle mouse click"""
     button = Button.left if button_code == 1 else Button.right if button_code == 2 else Button.middle
@@ -80,11 +103,31 @@ def handle_mouse_release(button_code):
     mouse.release(button)
     print(f"Mouse release: {button_code}")
 
-def process_command(data):
-    """Process incoming UDP command"""
+def handle_mouse_wheel(dy, dx):
+    """Handle mouse wheel (steps, positive = up / right)"""
+    mouse.scroll(dx, dy)
+    print(f"Mouse wheel: dy={dy}, dx={dx}")
+
+def process_command(data, client=None, recv_us=None, reply=None):
+    """Process incoming UDP command on the network thread: pings now, input via the scheduler"""
     if len(data) < 2:
         return
 
+    # Latency probe: answer pings, time-stamp everything else
+    if data[0] == CMD_PING:
+        pong = latency.handle_ping(client, data, recv_us)
+        if pong and reply:
+            reply(pong)
+        return
+    if recv_us is not None:
+        latency.note_packet(client, data, recv_us)
+    if data[0] == CMD_NOP:
+        return  # Benchmark traffic: nothing to inject, keep it out of the scheduler queues
+
+    scheduler.submit(client, data)
+
+def inject_command(data):
+    """Inject one command (called from the scheduler's injector thread)"""
     cmd_type = data[0]
 
     # Command types:
@@ -95,6 +138,9 @@ def process_command(data):
     # 5 = Mouse Click
     # 6 = Mouse Press
     # 7 = Mouse Release
+    # 8 = Mouse Wheel
+    # 9 = Mouse Absolute
+    # 10 = Ping (answered with 11 = Pong)
 
     if cmd_type == 1:  # Keyboard Press
         key_code = data[1]
@@ -126,19 +172,48 @@ def process_command(data):
         button_code = data[1]
         handle_mouse_release(button_code)
 
+    elif cmd_type == 8:  # Mouse Wheel
+        if len(data) >= 3:
+            dy = struct.unpack('b', bytes([data[1]]))[0]  # signed byte
+            dx = struct.unpack('b', bytes([data[2]]))[0]  # signed byte
+            handle_mouse_wheel(dy, dx)
+
+    elif cmd_type == 9:  # Mouse Absolute
+        if len(data) >= 5:
+            x, y = struct.unpack('>HH', bytes(data[1:5]))  # big-endian uint16
+            handle_mouse_absolute(x, y)
+
+def latency_reporter():
+    """Print one-way latency percentiles and scheduler counters every 10 seconds while packets arrive"""
+    last_count = 0
+    while True:
+        time.sleep(10)
+        s = latency.summary()
+        if s and s[3] != last_count:
+            last_count = s[3]
+            print(latency.summary_text())
+            print(scheduler.summary_text())
+
 def main():
     """Main server loop"""
     sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
     sock.bind((UDP_IP, UDP_PORT))
 
+    # TCP frames carry the controller as an (ip, port) tuple, UDP datagrams as the ip
+    on_frame = lambda data, addr, recv_us, reply: process_command(data, addr[0], recv_us, reply)
+    threading.Thread(target=tcp_server, args=(UDP_IP, TCP_PORT, on_frame), daemon=True).start()
+    threading.Thread(target=latency_reporter, daemon=True).start()
+
     print(f"GSPRO Controller WiFi Receiver")
-    print(f"Listening on {UDP_IP}:{UDP_PORT}")
+    print(f"Listening on {UDP_IP}:{UDP_PORT} (UDP) and {UDP_IP}:{TCP_PORT} (TCP)")
     print(f"Waiting for ESP32 controller...")
     print("-" * 50)
 
     while True:
         data, addr = sock.recvfrom(1024)
-        process_command(data)
+        process_command(data, addr[0], now_us(), lambda pong: sock.sendto(pong, addr))
+
+scheduler = InjectionScheduler(inject_command, MOTION_DEADLINE_MS)
 
 if __name__ == "__main__":
     try:
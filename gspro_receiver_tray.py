@@ -11,16 +11,30 @@ import threading
 import time
 from pynput.keyboard import Controller as KeyboardController, Key
 from pynput.mouse import Controller as MouseController, Button
+from gspro_latency import LatencyTracker, CMD_NOP, CMD_PING, now_us
+from gspro_scheduler import InjectionScheduler
+from gspro_net import get_monitor_rects, tcp_server
 from pystray import Icon, Menu, MenuItem
 from PIL import Image, ImageDraw
 
 # Configuration
 UDP_IP = "0.0.0.0"
 UDP_PORT = 5006
+TCP_PORT = 5006
+TABLET_MONITOR = 0  # Monitor the touchpad's tablet mode maps onto (0 = primary)
+MOTION_DEADLINE_MS = 50  # Mouse motion still queued after this long is dropped, not injected late
 
 # Initialize controllers
 keyboard = KeyboardController()
 mouse = MouseController()
+latency = LatencyTracker()
+
+# Absolute positions are physical pixels; without this, Windows scaling shifts the cursor
+try:
+    import ctypes
+    ctypes.windll.shcore.SetProcessDpiAwareness(2)  # Per-monitor DPI aware
+except Exception:
+    pass
 
 # Status tracking
 status = {
@@ -110,6 +124,15 @@ def handle_mouse_move(dx, dy):
     except:
         pass
 
+def handle_mouse_absolute(x, y):
+    """Handle absolute mouse position"""
+    try:
+        rects = get_monitor_rects()
+        left, top, width, height = rects[TABLET_MONITOR] if TABLET_MONITOR < len(rects) else rects[0]
+        mouse.position = (left + x * (width - 1) // 65535, top + y * (height - 1) // 65535)
+    except:
+        pass
+
 def handle_mouse_click(button_code):
     """Handle mouse click"""
     try:
@@ -134,8 +157,15 @@ def handle_mouse_release(button_code):
     except:
         pass
 
-def process_command(data, addr):
-    """Process incoming UDP command"""
+def handle_mouse_wheel(dy, dx):
+    """Handle mouse wheel"""
+    try:
+        mouse.scroll(dx, dy)
+    except:
+        pass
+
+def process_command(data, addr, recv_us=None, reply=None):
+    """Process incoming UDP command on the network thread: pings now, input via the scheduler"""
     if len(data) < 2:
         return
 
@@ -147,6 +177,23 @@ def process_command(data, addr):
 
     cmd_type = data[0]
 
+    # Latency probe: answer pings, time-stamp everything else
+    if cmd_type == CMD_PING:
+        pong = latency.handle_ping(addr[0], data, recv_us)
+        if pong and reply:
+            reply(pong)
+        return
+    if recv_us is not None:
+        latency.note_packet(addr[0], data, recv_us)
+    if data[0] == CMD_NOP:
+        return  # Benchmark traffic: nothing to inject, keep it out of the scheduler queues
+
+    scheduler.submit(addr[0], data)
+
+def inject_command(data):
+    """Inject one command (called from the scheduler's injector thread)"""
+    cmd_type = data[0]
+
     if cmd_type == 1:  # Keyboard Press
         handle_keyboard_press(data[1])
     elif cmd_type == 2:  # Keyboard Release
@@ -164,6 +211,15 @@ def process_command(data, addr):
         handle_mouse_press(data[1])
     elif cmd_type == 7:  # Mouse Release
         handle_mouse_release(data[1])
+    elif cmd_type == 8:  # Mouse Wheel
+        if len(data) >= 3:
+            dy = struct.unpack('b', bytes([data[1]]))[0]
+            dx = struct.unpack('b', bytes([data[2]]))[0]
+            handle_mouse_wheel(dy, dx)
+    elif cmd_type == 9:  # Mouse Absolute
+        if len(data) >= 5:
+            x, y = struct.unpack('>HH', bytes(data[1:5]))
+            handle_mouse_absolute(x, y)
 
 def udp_server():
     """UDP server thread"""
@@ -172,7 +228,7 @@ def udp_server():
     sock.bind((UDP_IP, UDP_PORT))
 
     print(f"GSPRO Controller WiFi Receiver")
-    print(f"Listening on {UDP_IP}:{UDP_PORT}")
+    print(f"Listening on {UDP_IP}:{UDP_PORT} (UDP) and {UDP_IP}:{TCP_PORT} (TCP)")
     print(f"Local IP: {status['local_ip']}")
     print(f"Running in system tray...")
     print("-" * 50)
@@ -180,7 +236,7 @@ def udp_server():
     while status['running']:
         try:
             data, addr = sock.recvfrom(1024)
-            process_command(data, addr)
+            process_command(data, addr, now_us(), lambda pong: sock.sendto(pong, addr))
         except socket.timeout:
             # Check if we should mark as disconnected (no message in 5 seconds)
             if status['connected'] and (time.time() - status['last_message']) > 5:
@@ -216,9 +272,11 @@ def on_show_status(icon, item):
 
 Status: {'Connected' if status['connected'] else 'Waiting...'}
 Local IP: {status['local_ip']}
-Port: {UDP_PORT}
+Port: {UDP_PORT} (UDP/TCP)
 Client IP: {status['client_ip'] if status['client_ip'] else 'None'}
 Messages: {status['message_count']}
+{latency.summary_text()}
+{scheduler.summary_text()}
 """
 
     messagebox.showinfo("GSPRO Controller Status", msg)
@@ -244,6 +302,11 @@ def main():
     server_thread = threading.Thread(target=udp_server, daemon=True)
     server_thread.start()
 
+    # Start TCP server thread
+    tcp_thread = threading.Thread(target=tcp_server, daemon=True,
+                                  args=(UDP_IP, TCP_PORT, process_command, lambda: status['running']))
+    tcp_thread.start()
+
     # Create system tray icon
     icon_image = create_icon(False)
 
@@ -267,6 +330,8 @@ def main():
     # Wait for server thread to finish
     server_thread.join(timeout=2)
 
+scheduler = InjectionScheduler(inject_command, MOTION_DEADLINE_MS)
+
 if __name__ == "__main__":
     try:
         main()
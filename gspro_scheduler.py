@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+GSPRO Controller injection scheduler, shared by both receivers.
+
+Network threads only enqueue commands; one injector thread drains a queue per
+controller. Key and button commands from any controller go before motion, so
+a controller flooding mouse moves (or a slow injection) cannot hold up another
+bay's Mulligan press or a key release. Consecutive motion commands are merged.
+Motion older than a deadline is fast-forwarded: collapsed into the newest
+absolute position plus one summed relative step when a key/button command waits
+behind it (so the click lands where the user put the cursor), and dropped only
+when nothing is queued behind it.
+"""
+
+import collections
+import threading
+import time
+
+MOVE, WHEEL, ABSOLUTE = 4, 8, 9
+MOTION = (MOVE, WHEEL, ABSOLUTE)
+RELEASES = (2, 7)  # Key and mouse button release: never refused, a lost one leaves it held down
+
+MAX_QUEUE = 256  # Per controller; when full, the oldest motion is evicted first
+
+
+class Entry:
+    __slots__ = ('cmd', 'data', 'first', 'last', 'merged')
+
+    def __init__(self, data, now):
+        self.cmd = data[0]
+        self.data = data
+        self.first = now    # Arrival of the oldest command folded into this entry
+        self.last = now     # Arrival of the newest
+        self.merged = 1
+
+
+def signed(b):
+    return b - 256 if b > 127 else b
+
+
+def merge(entry, data, now):
+    """Fold a motion command into the motion entry at the tail of its queue.
+
+    Returns False when the sum no longer fits the command's signed bytes; the
+    command then starts a new entry, so the wire format is kept unchanged."""
+    if entry.cmd == ABSOLUTE:
+        entry.data = bytes(data)  # Newest position wins
+    else:
+        a = signed(entry.data[1]) + signed(data[1])
+        b = signed(entry.data[2]) + signed(data[2])
+        if not (-128 <= a <= 127 and -128 <= b <= 127):
+            return False
+        entry.data = bytes([entry.cmd, a & 0xFF, b & 0xFF])
+    entry.last = now
+    entry.merged += 1
+    return True
+
+
+def relative_steps(cmd, a, b):
+    """Wire commands for a summed relative delta, split where it exceeds the signed bytes"""
+    out = []
+    while a or b:
+        da = max(-128, min(127, a))
+        db = max(-128, min(127, b))
+        out.append(bytes([cmd, da & 0xFF, db & 0xFF]))
+        a -= da
+        b -= db
+    return out
+
+
+def collapse(stale, keep_relative):
+    """Fast-forward a run of stale motion entries.
+
+    The newest absolute position is always kept: it is where the cursor has to
+    end up. Relative motion after it is summed into as few commands as fit the
+    wire format when keep_relative (something waits behind it), else dropped.
+    Returns (entries to keep, entries dropped)."""
+    last_abs = max((i for i, e in enumerate(stale) if e.cmd == ABSOLUTE), default=-1)
+    kept = [stale[last_abs]] if last_abs >= 0 else []
+    dropped = []
+
+    for cmd in (MOVE, WHEEL):
+        # Moves before the newest absolute position are superseded by it
+        sources = [e for i, e in enumerate(stale) if e.cmd == cmd and (cmd == WHEEL or i > last_abs)]
+        if not sources:
+            continue
+        if not keep_relative:
+            dropped += sources
+            continue
+        a = sum(signed(e.data[1]) for e in sources)
+        b = sum(signed(e.data[2]) for e in sources)
+        for data in relative_steps(cmd, a, b):
+            entry = Entry(data, sources[0].first)
+            entry.last = sources[-1].last
+            entry.merged = sum(e.merged for e in sources)
+            kept.append(entry)
+    return kept, dropped
+
+
+class ClientStats:
+    __slots__ = ('received', 'injected', 'merged', 'dropped', 'overflow',
+                 'delay_total', 'delay_max', 'priority_delay_max')
+
+    def __init__(self):
+        self.received = 0
+        self.injected = 0
+        self.merged = 0             # Motion commands folded into an earlier one
+        self.dropped = 0            # Late motion commands discarded with nothing queued behind them
+        self.overflow = 0           # Commands refused or motion evicted because the queue was full
+        self.delay_total = 0.0      # Seconds between arrival and injection, summed
+        self.delay_max = 0.0
+        self.priority_delay_max = 0.0
+
+
+class InjectionScheduler:
+    """Per-controller command queues drained by a single injector thread"""
+
+    def __init__(self, inject, motion_deadline_ms=50):
+        self.inject = inject
+        self.deadline = motion_deadline_ms / 1000.0
+        self.cond = threading.Condition()
+        self.queues = collections.OrderedDict()  # client -> deque of Entry, in round-robin order
+        self.stats = {}
+        self.thread = threading.Thread(target=self._run, daemon=True)
+        self.thread.start()
+
+    def submit(self, client, data):
+        """Queue one command (bytes, command byte first) from a network thread"""
+        now = time.perf_counter()
+        with self.cond:
+            queue = self.queues.get(client)
+            if queue is None:
+                queue = self.queues[client] = collections.deque()
+                self.stats[client] = ClientStats()
+            st = self.stats[client]
+            st.received += 1
+
+            tail = queue[-1] if queue else None
+            if data[0] in MOTION and tail is not None and tail.cmd == data[0] and merge(tail, data, now):
+                st.merged += 1
+                return
+            if len(queue) >= MAX_QUEUE:
+                # Make room from the oldest motion; releases always get in so nothing stays held down
+                victim = next((e for e in queue if e.cmd in MOTION), None)
+                if victim is not None:
+                    queue.remove(victim)
+                    st.overflow += victim.merged
+                elif data[0] not in RELEASES:
+                    st.overflow += 1
+                    return
+            queue.append(Entry(bytes(data), now))
+            self.cond.notify()
+
+    def _next(self, now):
+        """Pick the next entry: key/button heads first, then motion, both round-robin over controllers"""
+        for client, queue in self.queues.items():
+            if queue and queue[0].cmd not in MOTION:
+                # Rotate here too, or a controller sending a burst of keys would starve later ones
+                self.queues.move_to_end(client)
+                return client, queue.popleft()
+
+        for client, queue in list(self.queues.items()):
+            if queue and queue[0].cmd in MOTION and now - queue[0].last > self.deadline:
+                self._fast_forward(self.stats[client], queue, now)
+            if queue:
+                # Served: move this controller to the back of the round-robin order
+                self.queues.move_to_end(client)
+                return client, queue.popleft()
+        return None, None
+
+    def _fast_forward(self, st, queue, now):
+        """Replace the stale motion at the head of a queue by its collapsed form"""
+        stale = []
+        while queue and queue[0].cmd in MOTION and now - queue[0].last > self.deadline:
+            stale.append(queue.popleft())
+        kept, dropped = collapse(stale, keep_relative=bool(queue))
+        st.dropped += sum(e.merged for e in dropped)
+        st.merged += max(0, len(stale) - len(dropped) - len(kept))  # Entries folded into another
+        queue.extendleft(reversed(kept))
+
+    def _run(self):
+        while True:
+            with self.cond:
+                client, entry = self._next(time.perf_counter())
+                while entry is None:
+                    self.cond.wait()
+                    client, entry = self._next(time.perf_counter())
+
+                st = self.stats[client]
+                delay = time.perf_counter() - entry.first
+                st.injected += 1
+                st.delay_total += delay
+                st.delay_max = max(st.delay_max, delay)
+                if entry.cmd not in MOTION:
+                    st.priority_delay_max = max(st.priority_delay_max, delay)
+
+            try:
+                self.inject(entry.data)
+            except Exception as e:
+                print(f"Injection error: {e}")
+
+    def snapshot(self):
+        """Copy of the per-controller counters: {client: dict}"""
+        with self.cond:
+            return {client: {name: getattr(st, name) for name in ClientStats.__slots__}
+                    for client, st in self.stats.items()}
+
+    def summary_text(self):
+        lines = []
+        for client, st in self.snapshot().items():
+            avg = st['delay_total'] / st['injected'] * 1000 if st['injected'] else 0.0
+            lines.append(f"{client}: {st['received']} in, {st['injected']} injected, {st['merged']} merged, "
+                         f"{st['dropped']} late, {st['overflow']} overflow; queue delay avg {avg:.1f} ms, "
+                         f"max {st['delay_max'] * 1000:.1f} ms (keys/buttons {st['priority_delay_max'] * 1000:.1f} ms)")
+        return "\n".join(lines) if lines else "Scheduler: no commands yet"
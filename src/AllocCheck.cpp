@@ -0,0 +1,71 @@
+#include "AllocCheck.h"
+
+#ifdef ALLOC_CHECK
+#include <lvgl.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__real_lv_mem_alloc(size_t size);
+void *__real_lv_mem_realloc(void *ptr, size_t size);
+}
+
+static volatile TaskHandle_t s_task = NULL;    // Only this task's allocations are counted (not WiFi/lwIP)
+static AllocCheckResult s_counts;
+
+static void count(uint32_t *counter, void *caller) {
+    if (s_task == NULL || xTaskGetCurrentTaskHandle() != s_task) return;
+    (*counter)++;
+    if (!s_counts.firstCaller) {
+        // Xtensa keeps the call window size in the top bits of the return address
+        s_counts.firstCaller = ((uint32_t)caller & 0x3FFFFFFF) | 0x40000000;
+    }
+}
+
+extern "C" {
+void *__wrap_malloc(size_t size) {
+    count(&s_counts.mallocs, __builtin_return_address(0));
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    count(&s_counts.mallocs, __builtin_return_address(0));
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    count(&s_counts.mallocs, __builtin_return_address(0));
+    return __real_realloc(ptr, size);
+}
+
+void *__wrap_lv_mem_alloc(size_t size) {
+    count(&s_counts.lvAllocs, __builtin_return_address(0));
+    return __real_lv_mem_alloc(size);
+}
+
+void *__wrap_lv_mem_realloc(void *ptr, size_t size) {
+    count(&s_counts.lvAllocs, __builtin_return_address(0));
+    return __real_lv_mem_realloc(ptr, size);
+}
+}
+
+bool runAllocCheck(const char *name, void (*replay)(), AllocCheckResult *result) {
+    replay();
+
+    s_counts = {};
+    s_task = xTaskGetCurrentTaskHandle();
+    replay();
+    s_task = NULL;
+
+    bool pass = s_counts.mallocs == 0 && s_counts.lvAllocs == 0;
+    Serial.printf("Alloc check %s: %lu malloc, %lu lv_mem -> %s\n", name,
+                  (unsigned long)s_counts.mallocs, (unsigned long)s_counts.lvAllocs, pass ? "PASS" : "FAIL");
+    if (!pass) Serial.printf("  first allocation from 0x%08lx\n", (unsigned long)s_counts.firstCaller);
+
+    if (result) *result = s_counts;
+    return pass;
+}
+#endif
@@ -0,0 +1,18 @@
+#ifndef ALLOC_CHECK_H
+#define ALLOC_CHECK_H
+
+#include <Arduino.h>
+
+// Heap allocations counted on the calling task while a replay runs
+struct AllocCheckResult {
+    uint32_t mallocs;       // libc malloc/calloc/realloc (includes operator new and String)
+    uint32_t lvAllocs;      // LVGL lv_mem_alloc/lv_mem_realloc (label text, styles, anims)
+    uint32_t firstCaller;   // Code address of the first counted call, for addr2line
+};
+
+// Runs `replay` once to warm up (first-use allocations are not churn), then again
+// while counting, prints PASS/FAIL and returns true if nothing was allocated.
+// The counting hooks need the -Wl,--wrap flags of the esp32dev-alloccheck environment.
+bool runAllocCheck(const char *name, void (*replay)(), AllocCheckResult *result = NULL);
+
+#endif
@@ -1,16 +1,9 @@
 #include "BleCombo.h"
 #include "config.h"
 
-// Command types
-#define CMD_KEY_PRESS    1
-#define CMD_KEY_RELEASE  2
-#define CMD_KEY_WRITE    3
-#define CMD_MOUSE_MOVE   4
-#define CMD_MOUSE_CLICK  5
-#define CMD_MOUSE_PRESS  6
-#define CMD_MOUSE_RELEASE 7
-
-BleComboWrapper::BleComboWrapper(std::string name) : _deviceName(name), _wifiConnected(false), _pcPort(UDP_PORT) {
+BleComboWrapper::BleComboWrapper(std::string name)
+    : CommandEncoder(&_udpTransport), _deviceName(name), _pcPort(UDP_PORT), _wifiConnected(false),
+      _transportType(TRANSPORT_UDP) {
     _pcIP.fromString(PC_IP_ADDRESS);
 }
 
@@ -29,67 +22,113 @@ void BleComboWrapper::begin() {
     if (WiFi.status() == WL_CONNECTED) {
         _wifiConnected = true;
         Serial.printf("\nWiFi Connected! IP: %s\n", WiFi.localIP().toString().c_str());
-        Serial.printf("Sending to PC: %s:%d\n", _pcIP.toString().c_str(), _pcPort);
-        _udp.begin(0);  // Use any available port for sending
+        _radio.begin(RADIO_IDLE_TIMEOUT_MS);
+        _probe.begin(LATENCY_PROBE_INTERVAL_MS);
     } else {
-        Serial.println("\nWiFi connection failed!");
+        Serial.println("\nWiFi connection failed, will keep retrying");
         _wifiConnected = false;
     }
+
+    setTransport(DEFAULT_TRANSPORT);
 }
 
-bool BleComboWrapper::isConnected() {
-    return _wifiConnected && WiFi.status() == WL_CONNECTED;
+// WiFi came up after begin() gave up waiting: finish the setup begin() skipped and
+// start the transport that setTransport() left pending
+void BleComboWrapper::onWiFiConnected() {
+    _wifiConnected = true;
+    Serial.printf("WiFi Connected! IP: %s\n", WiFi.localIP().toString().c_str());
+    _radio.begin(RADIO_IDLE_TIMEOUT_MS);
+    _probe.begin(LATENCY_PROBE_INTERVAL_MS);
+    setTransport(_transportType);
 }
 
-void BleComboWrapper::sendCommand(uint8_t cmd, uint8_t* data, size_t len) {
-    if (!isConnected()) return;
+void BleComboWrapper::poll() {
+    if (!_wifiConnected && WiFi.status() == WL_CONNECTED) onWiFiConnected();
+    _radio.update();
+    if (!_transport->needsWiFi() || (_wifiConnected && WiFi.status() == WL_CONNECTED)) _transport->poll();
+    pollLatency();
+}
 
-    uint8_t packet[32];
-    packet[0] = cmd;
-    memcpy(packet + 1, data, len);
+void BleComboWrapper::pollLatency() {
+    uint8_t rx[TRANSPORT_MAX_PACKET];
+    size_t n;
+    while ((n = _transport->receive(rx, sizeof(rx))) > 0) {
+        if (rx[0] == CMD_PONG) _probe.onPong(rx + 1, n - 1, micros());
+    }
 
-    _udp.beginPacket(_pcIP, _pcPort);
-    _udp.write(packet, len + 1);
-    _udp.endPacket();
+    // Probe only while the user interacts: idle samples would measure modem sleep, and
+    // pings must not count as activity or the radio would never go back to power save
+    if (!_radio.isAwake() || !_probe.due(millis())) return;
+    sendPing();
 }
 
-void BleComboWrapper::k_press(uint8_t k) {
-    sendCommand(CMD_KEY_PRESS, &k, 1);
+void BleComboWrapper::sendPing() {
+    uint8_t *p = beginCommand(CMD_PING);
+    if (!p) return;
+    size_t len = _probe.writePing(p, millis());
+    bool ok = _transport->commit(len + 1);
+    _radio.onSendAttempt();
+    if (ok) _lastSendMs = millis();
 }
 
-void BleComboWrapper::k_release(uint8_t k) {
-    sendCommand(CMD_KEY_RELEASE, &k, 1);
+void BleComboWrapper::wake() {
+    _radio.wake();
+    resyncOnWake();
 }
 
-void BleComboWrapper::k_releaseAll() {
-    // Release all common keys
-    uint8_t keys[] = {0x80, 0x81, 0x82}; // Ctrl, Shift, Alt
-    for (uint8_t k : keys) {
-        k_release(k);
-    }
+// No pings go out while the radio is idle, so the receiver's copy of the clock
+// offset is stale once it wakes. Ping straight away rather than at the next interval;
+// the pong then triggers a second ping carrying the fresh offset.
+void BleComboWrapper::resyncOnWake() {
+    if (_radio.wakeCount() == _resyncWakeCount) return;
+    _resyncWakeCount = _radio.wakeCount();
+    _probe.requestPing();
+    sendPing();
 }
 
-void BleComboWrapper::k_write(uint8_t k) {
-    sendCommand(CMD_KEY_WRITE, &k, 1);
+bool BleComboWrapper::isConnected() {
+    if (_transport->needsWiFi() && !(_wifiConnected && WiFi.status() == WL_CONNECTED)) return false;
+    return _transport->connected();
 }
 
-void BleComboWrapper::m_click(uint8_t b) {
-    Serial.printf("Mouse click: %d\n", b);
-    sendCommand(CMD_MOUSE_CLICK, &b, 1);
+Transport &BleComboWrapper::transport(TransportType type) {
+    switch (type) {
+        case TRANSPORT_TCP:      return _tcpTransport;
+        case TRANSPORT_LOOPBACK: return _loopTransport;
+        case TRANSPORT_WIFIUDP:  return _wifiUdpTransport;
+        default:                 return _udpTransport;
+    }
+}
+
+bool BleComboWrapper::setTransport(TransportType type) {
+    if (type >= TRANSPORT_COUNT) return false;
+
+    _transport->end();
+    _transport = &transport(type);
+    _transportType = type;
+
+    uint16_t port = (type == TRANSPORT_TCP) ? TCP_PORT : _pcPort;
+    if (_transport->needsWiFi() && !_wifiConnected) {
+        Serial.printf("Transport %s selected, starts when WiFi connects\n", _transport->name());
+        return false;
+    }
+
+    bool ok = _transport->begin(_pcIP, port);
+    Serial.printf("Transport %s -> %u.%u.%u.%u:%u %s\n", _transport->name(),
+                  _pcIP[0], _pcIP[1], _pcIP[2], _pcIP[3], port, ok ? "ready" : "not connected");
+    return ok;
 }
 
-void BleComboWrapper::m_press(uint8_t b) {
-    Serial.printf("Mouse press: %d\n", b);
-    sendCommand(CMD_MOUSE_PRESS, &b, 1);
+bool BleComboWrapper::canSend() {
+    return isConnected();
 }
 
-void BleComboWrapper::m_release(uint8_t b) {
-    Serial.printf("Mouse release: %d\n", b);
-    sendCommand(CMD_MOUSE_RELEASE, &b, 1);
+void BleComboWrapper::onSendAttempt() {
+    _radio.onSendAttempt();
 }
 
-void BleComboWrapper::m_move(int8_t x, int8_t y) {
-    Serial.printf("Mouse move: x=%d, y=%d\n", x, y);
-    uint8_t data[2] = {(uint8_t)x, (uint8_t)y};
-    sendCommand(CMD_MOUSE_MOVE, data, 2);
+void BleComboWrapper::onCommandSent() {
+    _lastSendMs = millis();
+    _radio.onPacketSent();
+    resyncOnWake();  // Sent without a touch-down first (the send itself woke the radio)
 }
@@ -3,57 +3,63 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WiFiUdp.h>
 #include <string>
+#include "Transport.h"
+#include "CommandEncoder.h"
+#include "RadioPolicy.h"
+#include "LatencyProbe.h"
 
-// Keyboard Modifiers
-#define KEY_LEFT_CTRL   0x80
-#define KEY_LEFT_SHIFT  0x81
-#define KEY_LEFT_ALT    0x82
-#define KEY_LEFT_GUI    0x83
-#define KEY_RIGHT_CTRL  0x84
-#define KEY_RIGHT_SHIFT 0x85
-#define KEY_RIGHT_ALT   0x86
-#define KEY_RIGHT_GUI   0x87
-
-// Keyboard Keys
-#define KEY_UP_ARROW    0xDA
-#define KEY_DOWN_ARROW  0xD9
-#define KEY_LEFT_ARROW  0xD8
-#define KEY_RIGHT_ARROW 0xD7
-#define KEY_F5          0xC6
-
-// Mouse Buttons
-#define MOUSE_LEFT      0x01
-#define MOUSE_RIGHT     0x02
-#define MOUSE_MIDDLE    0x04
-
-class BleComboWrapper {
+// WiFi link to the receiver: transport selection, radio policy and latency probe
+// around the command encoder
+class BleComboWrapper : public CommandEncoder {
 public:
     BleComboWrapper(std::string name = "GSPRO Controller");
     void begin();
     bool isConnected();
+    void poll();    // Housekeeping, call from loop()
 
-    // Keyboard
-    void k_press(uint8_t k);
-    void k_release(uint8_t k);
-    void k_write(uint8_t k);
-    void k_releaseAll();
+    // Radio power policy (wake on touch-down, power save when idle)
+    RadioPolicy &radio() { return _radio; }
+    // Touch-down: wake the radio and, after an idle spell, ping before the first command
+    void wake();
 
-    // Mouse
-    void m_click(uint8_t b);
-    void m_press(uint8_t b);
-    void m_release(uint8_t b);
-    void m_move(int8_t x, int8_t y);
+    // Background RTT / clock offset probe against the receiver
+    LatencyProbe &latency() { return _probe; }
+
+    // millis() of the last frame handed to the transport (any command, pings included)
+    uint32_t lastSendMs() const { return _lastSendMs; }
+
+    // Transport selection (can be switched at any time after begin())
+    bool setTransport(TransportType type);
+    TransportType transportType() const { return _transportType; }
+    Transport &transport() { return *_transport; }
+    Transport &transport(TransportType type);
 
 private:
     std::string _deviceName;
-    WiFiUDP _udp;
     IPAddress _pcIP;
     uint16_t _pcPort;
     bool _wifiConnected;
 
-    void sendCommand(uint8_t cmd, uint8_t* data, size_t len);
+    UdpTransport _udpTransport;
+    WiFiUdpTransport _wifiUdpTransport;
+    TcpTransport _tcpTransport;
+    LoopbackTransport _loopTransport;
+    TransportType _transportType;
+    RadioPolicy _radio;
+    LatencyProbe _probe;
+    uint32_t _lastSendMs = 0;
+    uint32_t _resyncWakeCount = 0;
+
+    void onWiFiConnected();
+    void pollLatency();
+    void sendPing();
+    void resyncOnWake();
+
+protected:
+    bool canSend() override;
+    void onSendAttempt() override;
+    void onCommandSent() override;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "CommandEncoder.h"
+
+// Per-command logging runs on the input hot path (formatting, blocking UART writes);
+// build with -D DEBUG_INPUT to enable it
+#if defined(DEBUG_INPUT) && defined(ARDUINO)
+#define INPUT_LOG(...) Serial.printf(__VA_ARGS__)
+#else
+#define INPUT_LOG(...)
+#endif
+
+uint8_t *CommandEncoder::beginCommand(uint8_t cmd) {
+    if (!_transport || !canSend()) return NULL;
+
+    // Encode in place: the transport's frame buffer is reused for every packet
+    uint8_t *frame = _transport->txBuffer();
+    frame[0] = cmd;
+    return frame + 1;
+}
+
+bool CommandEncoder::endCommand(size_t payloadLen) {
+    uint8_t *ts = _transport->txBuffer() + 1 + payloadLen;
+    uint32_t now = micros();
+    ts[0] = now >> 24;
+    ts[1] = now >> 16;
+    ts[2] = now >> 8;
+    ts[3] = now;
+
+    bool ok = _transport->commit(payloadLen + 1 + CMD_TIMESTAMP_LEN);
+    onSendAttempt();
+    if (!ok) return false;
+    onCommandSent();
+    return true;
+}
+
+void CommandEncoder::sendCommand(uint8_t cmd, uint8_t value) {
+    uint8_t *p = beginCommand(cmd);
+    if (!p) return;
+    p[0] = value;
+    endCommand(1);
+}
+
+void CommandEncoder::k_press(uint8_t k) {
+    sendCommand(CMD_KEY_PRESS, k);
+}
+
+void CommandEncoder::k_release(uint8_t k) {
+    sendCommand(CMD_KEY_RELEASE, k);
+}
+
+void CommandEncoder::k_releaseAll() {
+    // Release all common keys
+    uint8_t keys[] = {0x80, 0x81, 0x82}; // Ctrl, Shift, Alt
+    for (uint8_t k : keys) {
+        k_release(k);
+    }
+}
+
+void CommandEncoder::k_write(uint8_t k) {
+    sendCommand(CMD_KEY_WRITE, k);
+}
+
+void CommandEncoder::m_click(uint8_t b) {
+    INPUT_LOG("Mouse click: %d\n", b);
+    sendCommand(CMD_MOUSE_CLICK, b);
+}
+
+void CommandEncoder::m_press(uint8_t b) {
+    INPUT_LOG("Mouse press: %d\n", b);
+    sendCommand(CMD_MOUSE_PRESS, b);
+}
+
+void CommandEncoder::m_release(uint8_t b) {
+    INPUT_LOG("Mouse release: %d\n", b);
+    sendCommand(CMD_MOUSE_RELEASE, b);
+}
+
+void CommandEncoder::m_move(int8_t x, int8_t y) {
+    INPUT_LOG("Mouse move: x=%d, y=%d\n", x, y);
+    uint8_t *p = beginCommand(CMD_MOUSE_MOVE);
+    if (!p) return;
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)y;
+    endCommand(2);
+}
+
+void CommandEncoder::m_wheel(int8_t vertical, int8_t horizontal) {
+    if (vertical == 0 && horizontal == 0) return;
+    uint8_t *p = beginCommand(CMD_MOUSE_WHEEL);
+    if (!p) return;
+    p[0] = (uint8_t)vertical;
+    p[1] = (uint8_t)horizontal;
+    endCommand(2);
+}
+
+void CommandEncoder::m_moveTo(uint16_t x, uint16_t y) {
+    uint8_t *p = beginCommand(CMD_MOUSE_ABS);
+    if (!p) return;
+    p[0] = x >> 8;
+    p[1] = x & 0xFF;
+    p[2] = y >> 8;
+    p[3] = y & 0xFF;
+    endCommand(4);
+}
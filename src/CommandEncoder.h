@@ -0,0 +1,87 @@
+#ifndef COMMAND_ENCODER_H
+#define COMMAND_ENCODER_H
+
+#include "TransportBase.h"
+
+// Keyboard Modifiers
+#define KEY_LEFT_CTRL   0x80
+#define KEY_LEFT_SHIFT  0x81
+#define KEY_LEFT_ALT    0x82
+#define KEY_LEFT_GUI    0x83
+#define KEY_RIGHT_CTRL  0x84
+#define KEY_RIGHT_SHIFT 0x85
+#define KEY_RIGHT_ALT   0x86
+#define KEY_RIGHT_GUI   0x87
+
+// Keyboard Keys
+#define KEY_UP_ARROW    0xDA
+#define KEY_DOWN_ARROW  0xD9
+#define KEY_LEFT_ARROW  0xD8
+#define KEY_RIGHT_ARROW 0xD7
+#define KEY_F5          0xC6
+
+// Mouse Buttons
+#define MOUSE_LEFT      0x01
+#define MOUSE_RIGHT     0x02
+#define MOUSE_MIDDLE    0x04
+
+// Command types (first byte of every packet, see API_REFERENCE.md)
+#define CMD_NOP          0  // Ignored by the receiver (benchmarks)
+#define CMD_KEY_PRESS    1
+#define CMD_KEY_RELEASE  2
+#define CMD_KEY_WRITE    3
+#define CMD_MOUSE_MOVE   4
+#define CMD_MOUSE_CLICK  5
+#define CMD_MOUSE_PRESS  6
+#define CMD_MOUSE_RELEASE 7
+#define CMD_MOUSE_WHEEL  8
+#define CMD_MOUSE_ABS    9
+#define CMD_PING         10 // Controller -> receiver, no timestamp trailer
+#define CMD_PONG         11 // Receiver -> controller
+
+// Every command except PING ends with the controller's micros() at send time (4 bytes, big-endian)
+#define CMD_TIMESTAMP_LEN 4
+
+// Encodes commands in place into the transport's frame buffer and appends the
+// timestamp trailer. No WiFi dependency, so the native tests drive the same code.
+class CommandEncoder {
+public:
+    explicit CommandEncoder(Transport *transport = NULL) : _transport(transport) {}
+    virtual ~CommandEncoder() {}
+
+    void setTransport(Transport *transport) { _transport = transport; }
+
+    // Keyboard
+    void k_press(uint8_t k);
+    void k_release(uint8_t k);
+    void k_write(uint8_t k);
+    void k_releaseAll();
+
+    // Mouse
+    void m_click(uint8_t b);
+    void m_press(uint8_t b);
+    void m_release(uint8_t b);
+    void m_move(int8_t x, int8_t y);
+    void m_wheel(int8_t vertical, int8_t horizontal = 0);  // Steps, + = up / right
+    void m_moveTo(uint16_t x, uint16_t y);  // Absolute, 0..65535 across the receiver's monitor
+
+    // Returns the payload area inside the transport's frame buffer, NULL if offline
+    uint8_t *beginCommand(uint8_t cmd);
+    // Appends the timestamp trailer and hands the frame to the transport
+    bool endCommand(size_t payloadLen);
+
+protected:
+    Transport *_transport;
+
+    // Gate checked before encoding; the firmware also requires WiFi
+    virtual bool canSend() { return _transport->connected(); }
+    // Called after every command handed to the transport, accepted or not
+    virtual void onSendAttempt() {}
+    // Called after every command the transport accepted
+    virtual void onCommandSent() {}
+
+private:
+    void sendCommand(uint8_t cmd, uint8_t value);
+};
+
+#endif
@@ -0,0 +1,170 @@
+#include "EventLoop.h"
+#include "lwip/sockets.h"
+#include "driver/gpio.h"
+#include "hal/gpio_ll.h"
+#include "esp_sleep.h"
+
+void EventLoop::begin(int8_t touchIntPin) {
+    _loopTask = xTaskGetCurrentTaskHandle();
+    resetStats();
+
+    _touchPin = touchIntPin;
+    if (_touchPin >= 0) {
+        // FT6336 pulls INT low while touched (or pulses it per report). Level-triggered so it
+        // also works as a light sleep wake source; the ISR disarms itself until rearmTouch().
+        pinMode(_touchPin, INPUT);
+        attachInterruptArg(_touchPin, touchIsr, this, ONLOW);
+    }
+
+    openControlSocket();
+    xTaskCreate(netWatchTask, "netwake", 3072, this, 2, &_netTask);
+}
+
+// lwip_select() cannot be woken by a task notification, so the watcher also selects on
+// a UDP socket connected to itself on loopback; watchSocket() sends it a byte when the
+// socket to watch changes (the same self-pipe trick as esp_http_server's control socket)
+void EventLoop::openControlSocket() {
+    _ctrlFd = lwip_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (_ctrlFd < 0) return;
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    if (lwip_bind(_ctrlFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        lwip_getsockname(_ctrlFd, (struct sockaddr *)&addr, &len) < 0 ||
+        lwip_connect(_ctrlFd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        lwip_close(_ctrlFd);
+        _ctrlFd = -1;  // Watcher falls back to re-reading the socket every SELECT_TIMEOUT_MS
+        return;
+    }
+    lwip_fcntl(_ctrlFd, F_SETFL, lwip_fcntl(_ctrlFd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+void EventLoop::drainControlSocket() {
+    uint8_t buf[8];
+    while (lwip_recv(_ctrlFd, buf, sizeof(buf), MSG_DONTWAIT) > 0) {}
+}
+
+void IRAM_ATTR EventLoop::touchIsr(void *arg) {
+    EventLoop *self = (EventLoop *)arg;
+    gpio_ll_intr_disable(&GPIO, (gpio_num_t)self->_touchPin);  // Would retrigger while the finger stays down
+    if (!self->_touchIrqPending) {
+        self->_touchIrqUs = micros();
+        self->_touchIrqPending = true;
+    }
+
+    BaseType_t woken = pdFALSE;
+    xTaskNotifyFromISR(self->_loopTask, WAKE_TOUCH, eSetBits, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+void EventLoop::rearmTouch() {
+    if (_touchPin >= 0) gpio_intr_enable((gpio_num_t)_touchPin);
+}
+
+void EventLoop::enableLightSleepWake() {
+    if (_touchPin < 0) return;
+    gpio_wakeup_enable((gpio_num_t)_touchPin, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+}
+
+void EventLoop::notify(uint32_t reason) {
+    if (_loopTask) xTaskNotify(_loopTask, reason, eSetBits);
+}
+
+void EventLoop::watchSocket(int fd, bool wantsWrite) {
+    if (fd == _watchFd && wantsWrite == _watchWrite) return;
+    _watchFd = fd;
+    _watchWrite = wantsWrite;
+    if (!_netTask) return;
+    xTaskNotifyGive(_netTask);                          // Idle watcher, waiting for a socket
+    if (_ctrlFd >= 0) lwip_send(_ctrlFd, "", 1, 0);     // Watcher blocked in select()
+}
+
+// Blocks in select() on the transport socket so a pong wakes the loop at once
+// (its receive timestamp is the RTT sample) instead of at the next timer. While a
+// TCP connect is in progress it waits for writability, so the loop completes the
+// connection as soon as the handshake does. The socket is re-read after every select().
+void EventLoop::netWatchTask(void *arg) {
+    EventLoop *self = (EventLoop *)arg;
+    for (;;) {
+        int fd = self->_watchFd;
+        bool wantsWrite = self->_watchWrite;
+        if (fd < 0) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        fd_set readable, writable;
+        FD_ZERO(&readable);
+        FD_ZERO(&writable);
+        FD_SET(fd, &readable);
+        if (wantsWrite) FD_SET(fd, &writable);
+        int maxFd = fd;
+        if (self->_ctrlFd >= 0) {
+            FD_SET(self->_ctrlFd, &readable);
+            if (self->_ctrlFd > maxFd) maxFd = self->_ctrlFd;
+        }
+        struct timeval tv = { SELECT_TIMEOUT_MS / 1000, (SELECT_TIMEOUT_MS % 1000) * 1000 };
+        int n = lwip_select(maxFd + 1, &readable, wantsWrite ? &writable : NULL, NULL, &tv);
+
+        if (n > 0 && self->_ctrlFd >= 0 && FD_ISSET(self->_ctrlFd, &readable)) {
+            // Socket to watch changed: start over with the new one
+            self->drainControlSocket();
+            n--;
+            if (n == 0) continue;
+        }
+
+        if (n > 0) {
+            self->notify(WAKE_NET);
+            // Until the loop has drained the socket, select() would return again immediately
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DRAIN_TIMEOUT_MS));
+        } else if (n < 0) {
+            // Socket closed under us (transport switch or reconnect): wait for the next one
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SELECT_TIMEOUT_MS));
+        }
+    }
+}
+
+uint32_t EventLoop::wait(uint32_t timeoutMs) {
+    // The previous iteration polled the transport, so the watcher may select() again
+    if (_netPending) {
+        _netPending = false;
+        xTaskNotifyGive(_netTask);
+    }
+
+    if (timeoutMs > MAX_SLEEP_MS) timeoutMs = MAX_SLEEP_MS;
+    uint32_t bits = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &bits, pdMS_TO_TICKS(timeoutMs));
+
+    _stats.wakeups++;
+    if (bits & WAKE_TOUCH) _stats.touchWakes++;
+    if (bits & WAKE_NET) {
+        _stats.netWakes++;
+        _netPending = true;
+    }
+    return bits;
+}
+
+void EventLoop::onTouchRead(bool touchDown) {
+    if (!_touchIrqPending) return;
+
+    uint32_t elapsed = micros() - _touchIrqUs;
+    _touchIrqPending = false;
+    if (!touchDown) return;  // Report pulse during a touch or on lift, not an input start
+
+    _stats.inputs++;
+    _stats.lastInputUs = elapsed;
+    if (elapsed > _stats.maxInputUs) _stats.maxInputUs = elapsed;
+}
+
+void EventLoop::resetStats() {
+    _stats = {};
+    _stats.startMs = millis();
+}
+
+uint32_t EventLoop::wakeupsPerSec10() const {
+    uint32_t elapsed = millis() - _stats.startMs;
+    return elapsed ? (uint32_t)((uint64_t)_stats.wakeups * 10000 / elapsed) : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Reasons wait() returned early (notification bits, may be combined)
+#define WAKE_TOUCH  0x01    // Touch controller interrupt
+#define WAKE_NET    0x02    // Transport socket readable (or writable, see watchSocket())
+#define WAKE_WIFI   0x04    // WiFi connected/disconnected
+
+// Counters since the last resetStats()
+struct EventLoopStats {
+    uint32_t wakeups;       // Returns from wait(), timeouts included
+    uint32_t touchWakes;
+    uint32_t netWakes;
+    uint32_t inputs;        // Touch-downs timed from interrupt to input read
+    uint32_t lastInputUs;   // Touch interrupt -> LVGL input read (which runs the press handlers)
+    uint32_t maxInputUs;
+    uint32_t startMs;
+};
+
+// Sleeps the Arduino loop task until the next LVGL timer deadline, a touch
+// interrupt, a frame from the receiver or a WiFi event, whichever comes first.
+class EventLoop {
+public:
+    void begin(int8_t touchIntPin);     // Call from setup() (the loop task); -1 = poll touch instead
+    // Socket to wake on, -1 = none; writable too while a non-blocking connect is in
+    // progress (wantsWrite). Cheap to call every loop, the watcher restarts only on a change.
+    void watchSocket(int fd, bool wantsWrite = false);
+    uint32_t wait(uint32_t timeoutMs);  // Returns WAKE_* bits, 0 on timeout
+    void notify(uint32_t reason);       // From other tasks (not ISRs)
+
+    bool touchInterrupt() const { return _touchPin >= 0; }
+    void onTouchRead(bool touchDown);   // From the input driver, for interrupt -> read latency
+    void rearmTouch();                  // After release: the interrupt fires once per touch
+    uint32_t touchIrqUs() const { return _touchIrqUs; }
+    void enableLightSleepWake();        // Let the touch interrupt end automatic light sleep
+
+    const EventLoopStats &stats() const { return _stats; }
+    void resetStats();
+    uint32_t wakeupsPerSec10() const;   // Wakeups per second x10
+
+private:
+    static const uint32_t MAX_SLEEP_MS = 1000;      // Radio idle and ping deadlines are checked at least this often
+    static const uint32_t SELECT_TIMEOUT_MS = 1000; // Fallback re-read of the socket without a control socket
+    static const uint32_t DRAIN_TIMEOUT_MS = 100;
+
+    TaskHandle_t _loopTask = NULL;
+    TaskHandle_t _netTask = NULL;
+    int8_t _touchPin = -1;
+    volatile int _watchFd = -1;
+    volatile bool _watchWrite = false;
+    int _ctrlFd = -1;   // Loopback UDP socket: a datagram to it interrupts the watcher's select()
+    bool _netPending = false;
+
+    volatile bool _touchIrqPending = false;
+    volatile uint32_t _touchIrqUs = 0;
+
+    EventLoopStats _stats = {};
+
+    static void IRAM_ATTR touchIsr(void *arg);
+    void openControlSocket();
+    void drainControlSocket();
+    static void netWatchTask(void *arg);
+};
+
+#endif
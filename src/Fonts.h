@@ -0,0 +1,21 @@
+#ifndef FONTS_H
+#define FONTS_H
+
+#include <lvgl.h>
+
+// Glyph-subset fonts generated at build time by gen_fonts.py. Without Node.js
+// the build falls back to the built-in Montserrat 14 for every size.
+#ifdef GSPRO_FONTS
+LV_FONT_DECLARE(gspro_font_14)
+LV_FONT_DECLARE(gspro_font_18)
+LV_FONT_DECLARE(gspro_font_24)
+#define FONT_SMALL  (&gspro_font_14)    // Status text, hints, header buttons
+#define FONT_BUTTON (&gspro_font_18)    // Action and navigation buttons
+#define FONT_HEADER (&gspro_font_24)    // Header logo text
+#else
+#define FONT_SMALL  (&lv_font_montserrat_14)
+#define FONT_BUTTON (&lv_font_montserrat_14)
+#define FONT_HEADER (&lv_font_montserrat_14)
+#endif
+
+#endif
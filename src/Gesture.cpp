@@ -0,0 +1,184 @@
+#include "Gesture.h"
+
+static const GestureEvent NO_EVENT = {GESTURE_NONE, 0, 0, 0};
+
+static inline int32_t iabs(int32_t v) { return v < 0 ? -v : v; }
+
+static bool within(const GesturePoint &a, const GesturePoint &b, int16_t slop) {
+    return iabs(a.x - b.x) <= slop && iabs(a.y - b.y) <= slop;
+}
+
+// Integer square root (bitwise, 16 iterations for 32-bit input)
+static uint32_t isqrt(uint32_t v) {
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+static int32_t spreadOf(const GesturePoint *pts) {
+    int32_t dx = pts[1].x - pts[0].x;
+    int32_t dy = pts[1].y - pts[0].y;
+    return (int32_t)isqrt((uint32_t)(dx * dx + dy * dy));
+}
+
+static GesturePoint centroidOf(const GesturePoint *pts) {
+    GesturePoint c = {(int16_t)((pts[0].x + pts[1].x) / 2), (int16_t)((pts[0].y + pts[1].y) / 2)};
+    return c;
+}
+
+void GestureRecognizer::reset() {
+    _mode = MODE_IDLE;
+    _fingers = 0;
+    _dragging = false;
+    _tapPending = false;
+}
+
+GestureEvent GestureRecognizer::update(const GesturePoint *pts, uint8_t count, uint32_t nowMs) {
+    uint8_t prev = _fingers;
+    _fingers = count;
+
+    if (count == 0) {
+        return prev ? release(nowMs) : NO_EVENT;
+    }
+
+    if (count >= 2) {
+        if (_mode == MODE_TWO || _mode == MODE_SCROLL || _mode == MODE_PINCH) {
+            return trackTwo(pts);
+        }
+
+        // Second finger landed: abandon single-finger tracking and start a two-finger gesture
+        GestureEvent ev = NO_EVENT;
+        if (_dragging) {
+            _dragging = false;
+            ev.type = GESTURE_DRAG_END;
+        }
+        if (_mode == MODE_IDLE) _downMs = nowMs;
+        _mode = MODE_TWO;
+        _tapPending = false;
+        _last = centroidOf(pts);
+        _spread0 = spreadOf(pts);
+        _scrollAccX = 0;
+        _scrollAccY = 0;
+        return ev;
+    }
+
+    switch (_mode) {
+        case MODE_IDLE:
+            return beginOne(pts[0], nowMs);
+        case MODE_ONE:
+        case MODE_ONE_MOVING:
+            return trackOne(pts[0]);
+        case MODE_SCROLL:
+        case MODE_PINCH:
+            _mode = MODE_LIFTING;  // One finger left: the gesture is over, ignore the other
+            return NO_EVENT;
+        default:
+            return NO_EVENT;  // MODE_TWO stays a two-finger tap candidate while fingers lift
+    }
+}
+
+GestureEvent GestureRecognizer::beginOne(const GesturePoint &p, uint32_t nowMs) {
+    _mode = MODE_ONE;
+    _down = p;
+    _last = p;
+    _downMs = nowMs;
+
+    bool doubleTap = _tapPending && (nowMs - _lastTapMs) <= DOUBLE_TAP_MS && within(p, _lastTap, DOUBLE_TAP_SLOP_PX);
+    _tapPending = false;
+    if (!doubleTap) return NO_EVENT;
+
+    _dragging = true;
+    GestureEvent ev = NO_EVENT;
+    ev.type = GESTURE_DOUBLE_TAP;
+    return ev;
+}
+
+GestureEvent GestureRecognizer::trackOne(const GesturePoint &p) {
+    // Jitter inside the slop must not move the cursor, or taps would land off target
+    if (_mode == MODE_ONE) {
+        if (within(p, _down, TAP_SLOP_PX)) return NO_EVENT;
+        _mode = MODE_ONE_MOVING;
+    }
+
+    GestureEvent ev = NO_EVENT;
+    ev.dx = p.x - _last.x;
+    ev.dy = p.y - _last.y;
+    _last = p;
+    if (ev.dx == 0 && ev.dy == 0) return ev;
+
+    ev.type = GESTURE_MOVE;
+    return ev;
+}
+
+GestureEvent GestureRecognizer::trackTwo(const GesturePoint *pts) {
+    GesturePoint c = centroidOf(pts);
+    int32_t spread = spreadOf(pts);
+    _scrollAccX += c.x - _last.x;
+    _scrollAccY += c.y - _last.y;
+    _last = c;
+
+    if (_mode == MODE_TWO) {
+        if (iabs(spread - _spread0) >= PINCH_START_PX) {
+            _mode = MODE_PINCH;
+        } else if (iabs(_scrollAccX) >= SCROLL_START_PX || iabs(_scrollAccY) >= SCROLL_START_PX) {
+            _mode = MODE_SCROLL;
+        } else {
+            return NO_EVENT;
+        }
+    }
+
+    GestureEvent ev = NO_EVENT;
+    if (_mode == MODE_PINCH) {
+        int32_t steps = (spread - _spread0) / PINCH_PX_PER_STEP;
+        if (steps == 0) return ev;
+        _spread0 += steps * PINCH_PX_PER_STEP;  // Keep the remainder for the next sample
+        ev.type = GESTURE_PINCH;
+        ev.steps = (int16_t)steps;
+        return ev;
+    }
+
+    int32_t stepsX = _scrollAccX / SCROLL_PX_PER_STEP;
+    int32_t stepsY = _scrollAccY / SCROLL_PX_PER_STEP;
+    if (stepsX == 0 && stepsY == 0) return ev;
+    _scrollAccX -= stepsX * SCROLL_PX_PER_STEP;
+    _scrollAccY -= stepsY * SCROLL_PX_PER_STEP;
+
+    // Content follows the fingers: dragging down scrolls up (wheel +), dragging right scrolls left
+    ev.type = GESTURE_SCROLL;
+    ev.dx = (int16_t)-stepsX;
+    ev.dy = (int16_t)stepsY;
+    return ev;
+}
+
+GestureEvent GestureRecognizer::release(uint32_t nowMs) {
+    Mode mode = _mode;
+    _mode = MODE_IDLE;
+
+    GestureEvent ev = NO_EVENT;
+    if (_dragging) {
+        _dragging = false;
+        ev.type = GESTURE_DRAG_END;
+        return ev;
+    }
+
+    bool quick = (nowMs - _downMs) <= TAP_MAX_MS;
+    if (mode == MODE_ONE && quick) {
+        _tapPending = true;
+        _lastTapMs = nowMs;
+        _lastTap = _down;
+        ev.type = GESTURE_TAP;
+    } else if (mode == MODE_TWO && quick) {
+        ev.type = GESTURE_TWO_FINGER_TAP;
+    }
+    return ev;
+}
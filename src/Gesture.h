@@ -0,0 +1,82 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <stdint.h>
+
+// Touch position in screen pixels
+struct GesturePoint {
+    int16_t x;
+    int16_t y;
+};
+
+enum GestureType : uint8_t {
+    GESTURE_NONE = 0,
+    GESTURE_MOVE,           // One finger moved: dx/dy in pixels
+    GESTURE_TAP,            // One finger down and up without moving
+    GESTURE_DOUBLE_TAP,     // Second touch-down right after a tap: hold to drag
+    GESTURE_DRAG_END,       // Finger lifted after GESTURE_DOUBLE_TAP
+    GESTURE_TWO_FINGER_TAP, // Two fingers down and up without moving
+    GESTURE_SCROLL,         // Two fingers moved together: dx/dy in wheel steps
+    GESTURE_PINCH           // Two fingers spread/closed: steps (+ spread, - close)
+};
+
+struct GestureEvent {
+    GestureType type;
+    int16_t dx;
+    int16_t dy;
+    int16_t steps;
+};
+
+// Incremental recognizer: feed every touch sample exactly once, get at most one
+// event back. Integer arithmetic only, no allocation, constant time per sample.
+class GestureRecognizer {
+public:
+    GestureEvent update(const GesturePoint *pts, uint8_t count, uint32_t nowMs);
+    void reset();
+
+    uint8_t fingers() const { return _fingers; }
+    bool singleFinger() const { return _mode == MODE_ONE || _mode == MODE_ONE_MOVING; }
+
+private:
+    static const uint32_t TAP_MAX_MS = 200;         // Longest touch that still counts as a tap
+    static const uint32_t DOUBLE_TAP_MS = 300;      // Max gap between tap release and next touch-down
+    static const int16_t TAP_SLOP_PX = 8;           // Movement allowed during a tap
+    static const int16_t DOUBLE_TAP_SLOP_PX = 40;   // Distance allowed between the two taps
+    static const int16_t SCROLL_START_PX = 10;      // Centroid travel before a scroll is recognised
+    static const int16_t PINCH_START_PX = 20;       // Spread change before a pinch is recognised
+    static const int16_t SCROLL_PX_PER_STEP = 12;   // Centroid travel per wheel step
+    static const int16_t PINCH_PX_PER_STEP = 24;    // Spread change per zoom step
+
+    enum Mode : uint8_t {
+        MODE_IDLE,
+        MODE_ONE,           // Single finger, tap candidate until it moves past the slop
+        MODE_ONE_MOVING,    // Single finger tracking the pointer
+        MODE_TWO,           // Two fingers, undecided
+        MODE_SCROLL,
+        MODE_PINCH,
+        MODE_LIFTING        // Multi-finger gesture ended, wait for all fingers up
+    };
+
+    Mode _mode = MODE_IDLE;
+    uint8_t _fingers = 0;
+    bool _dragging = false;
+
+    uint32_t _downMs = 0;
+    GesturePoint _down = {0, 0};    // Touch-down position (one finger)
+    GesturePoint _last = {0, 0};    // Previous position (one finger) or centroid (two)
+
+    uint32_t _lastTapMs = 0;
+    GesturePoint _lastTap = {0, 0};
+    bool _tapPending = false;       // A tap happened recently, next touch-down may be a double tap
+
+    int32_t _spread0 = 0;           // Finger distance already accounted for in pinch steps
+    int32_t _scrollAccX = 0;        // Centroid travel not yet emitted as wheel steps
+    int32_t _scrollAccY = 0;
+
+    GestureEvent beginOne(const GesturePoint &p, uint32_t nowMs);
+    GestureEvent trackOne(const GesturePoint &p);
+    GestureEvent trackTwo(const GesturePoint *pts);
+    GestureEvent release(uint32_t nowMs);
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "GestureCommands.h"
+
+static int8_t clampInt8(int32_t v) {
+    return v < -127 ? -127 : v > 127 ? 127 : (int8_t)v;
+}
+
+void sendGestureCommands(CommandEncoder &out, const GestureEvent &g, bool absolute) {
+    switch (g.type) {
+        case GESTURE_MOVE:
+            if (absolute) break;  // Position already sent for this sample
+
+            // Scale the movement for better control (multiplied by 3 for faster movement)
+            out.m_move(clampInt8(g.dx * 3), clampInt8(g.dy * 3));
+            break;
+        case GESTURE_TAP:
+            out.m_click(MOUSE_LEFT);
+            break;
+        case GESTURE_DOUBLE_TAP:
+            // Press on the second touch-down: release -> double click, hold and move -> drag
+            out.m_press(MOUSE_LEFT);
+            break;
+        case GESTURE_DRAG_END:
+            out.m_release(MOUSE_LEFT);
+            break;
+        case GESTURE_TWO_FINGER_TAP:
+            out.m_click(MOUSE_RIGHT);
+            break;
+        case GESTURE_SCROLL:
+            out.m_wheel(clampInt8(g.dy), clampInt8(g.dx));
+            break;
+        case GESTURE_PINCH:
+            // Ctrl + wheel is zoom in GSPRO and most Windows apps
+            out.k_press(KEY_LEFT_CTRL);
+            out.m_wheel(clampInt8(g.steps), 0);
+            out.k_release(KEY_LEFT_CTRL);
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,12 @@
+#ifndef GESTURE_COMMANDS_H
+#define GESTURE_COMMANDS_H
+
+#include "Gesture.h"
+#include "CommandEncoder.h"
+
+// Turns one recognised touchpad gesture into mouse/keyboard commands. In tablet
+// mode (absolute) single-finger movement is sent as positions by the caller, so
+// GESTURE_MOVE produces nothing here.
+void sendGestureCommands(CommandEncoder &out, const GestureEvent &g, bool absolute);
+
+#endif
@@ -0,0 +1,47 @@
+#include "ImageStream.h"
+
+// One stripe of decoded pixels (1 KB static), pushed to the panel whenever it fills
+static const uint16_t STRIPE_PIXELS = 512;
+static uint16_t stripe[STRIPE_PIXELS];
+
+uint32_t drawRleImage(TFT_eSPI &tft, const RleImage &img, int16_t x, int16_t y, uint32_t *pushUs) {
+    uint32_t start = micros();
+    uint32_t push = 0;
+    uint32_t total = (uint32_t)img.width * img.height;
+    uint32_t written = 0;
+    uint16_t fill = 0;
+
+    tft.startWrite();
+    tft.setAddrWindow(x, y, img.width, img.height);
+
+    uint32_t pos = 0;
+    while (pos < img.dataLen && written + fill < total) {
+        uint8_t token = pgm_read_byte(&img.data[pos++]);
+        uint8_t count = (token & 0x7F) + 1;
+        bool run = token & 0x80;
+        uint16_t color = 0;
+        if (run) color = pgm_read_word(&img.palette[pgm_read_byte(&img.data[pos++])]);
+
+        while (count--) {
+            if (!run) color = pgm_read_word(&img.palette[pgm_read_byte(&img.data[pos++])]);
+            stripe[fill++] = color;
+            if (fill == STRIPE_PIXELS) {
+                uint32_t t = micros();
+                tft.pushColors(stripe, fill, true);
+                push += micros() - t;
+                written += fill;
+                fill = 0;
+            }
+        }
+    }
+    if (fill) {
+        uint32_t t = micros();
+        tft.pushColors(stripe, fill, true);
+        push += micros() - t;
+        written += fill;
+    }
+
+    tft.endWrite();
+    if (pushUs) *pushUs = push;
+    return micros() - start;
+}
@@ -0,0 +1,22 @@
+#ifndef IMAGE_STREAM_H
+#define IMAGE_STREAM_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Palette + RLE compressed RGB565 image, generated by convert_img.py
+struct RleImage {
+    uint16_t width;
+    uint16_t height;
+    uint16_t paletteSize;
+    const uint16_t *palette;    // RGB565
+    const uint8_t *data;        // Run/literal token stream
+    uint32_t dataLen;
+};
+
+// Decodes straight into the panel's address window in fixed-size stripes, no
+// frame buffer. Returns the time taken in microseconds (decode + SPI push);
+// pushUs, if given, receives the part spent waiting on the SPI pushes.
+uint32_t drawRleImage(TFT_eSPI &tft, const RleImage &img, int16_t x, int16_t y, uint32_t *pushUs = NULL);
+
+#endif
@@ -0,0 +1,109 @@
+#include "LatencyProbe.h"
+#include <algorithm>
+
+static void putU32(uint8_t *p, uint32_t v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static uint32_t getU32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+size_t LatencyProbe::writePing(uint8_t *payload, uint32_t nowMs) {
+    _lastPingMs = nowMs;
+    _pingNow = false;
+    if (++_seq == 0) _seq = 1;  // 0 marks a free pending slot
+    _sent++;
+
+    // Overwrites the oldest outstanding ping: a pong for it arriving now is too late to count
+    _pending[_pendingHead] = _seq;
+    _pendingHead = (_pendingHead + 1) % PENDING;
+
+    payload[0] = _seq >> 8;
+    payload[1] = _seq & 0xFF;
+    putU32(payload + 2, micros());  // t1, taken last so it is as close to the send as possible
+    putU32(payload + 6, _offset);
+    payload[10] = offsetFresh(nowMs) ? 1 : 0;   // A stale offset is not handed to the receiver
+    return PING_PAYLOAD_LEN;
+}
+
+// Consumes the pending slot, so a duplicated pong is ignored like an unknown one
+bool LatencyProbe::matchPending(uint16_t seq) {
+    if (seq == 0) return false;
+    for (uint8_t i = 0; i < PENDING; i++) {
+        if (_pending[i] == seq) {
+            _pending[i] = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+void LatencyProbe::onPong(const uint8_t *payload, size_t len, uint32_t t4) {
+    if (len < PONG_PAYLOAD_LEN) return;
+
+    uint16_t seq = ((uint16_t)payload[0] << 8) | payload[1];
+    uint32_t t1 = getU32(payload + 2);
+    uint32_t t2 = getU32(payload + 6);
+    uint32_t t3 = getU32(payload + 10);
+
+    // All clocks wrap at 2^32 us; unsigned differences stay correct across the wrap
+    uint32_t rtt = (t4 - t1) - (t3 - t2);
+    if (rtt > 10000000UL) return;  // Stale or corrupt reply (> 10 s)
+    if (!matchPending(seq)) return;  // Unknown, long overdue or duplicated
+
+    // NTP: offset = ((t2 - t1) + (t3 - t4)) / 2, averaged relative to the first term so
+    // the arbitrary distance between the two clocks never overflows a signed 32-bit value
+    uint32_t a = t2 - t1;
+    int32_t d = (int32_t)((t3 - t4) - a);
+    uint32_t offset = a + d / 2;
+
+    _received++;
+    _lastRttUs = rtt;
+    _rtt[_rttHead] = rtt;
+    _rttHead = (_rttHead + 1) % WINDOW;
+    if (_rttCount < WINDOW) _rttCount++;
+
+    // First pong after an idle spell: the filtered samples predate the drift, so start
+    // over, and ping again at once so the receiver gets the new offset within one RTT
+    uint32_t nowMs = millis();
+    if (!_synced || nowMs - _lastPongMs >= OFFSET_MAX_AGE_MS) {
+        _filterHead = _filterCount = 0;
+        if (_synced) requestPing();
+    }
+    _lastPongMs = nowMs;
+
+    Sample &s = _filter[_filterHead];
+    s.rtt = rtt;
+    s.offset = offset;
+    s.ms = nowMs;
+    _filterHead = (_filterHead + 1) % FILTER;
+    if (_filterCount < FILTER) _filterCount++;
+
+    // The lowest-RTT exchange has the least queueing asymmetry, so its offset is the most
+    // accurate; samples past OFFSET_MAX_AGE_MS have drifted and are skipped (the new one never is)
+    const Sample *best = &s;
+    for (uint8_t i = 0; i < _filterCount; i++) {
+        const Sample &c = _filter[i];
+        if (c.rtt < best->rtt && nowMs - c.ms < OFFSET_MAX_AGE_MS) best = &c;
+    }
+    _offset = best->offset;
+    _offsetMs = best->ms;   // Freshness is the age of the sample the offset came from
+    _synced = true;
+}
+
+bool LatencyProbe::percentiles(uint32_t *p50, uint32_t *p95, uint32_t *p99) const {
+    if (_rttCount == 0) return false;
+
+    static uint32_t sorted[WINDOW];
+    std::copy(_rtt, _rtt + _rttCount, sorted);
+    std::sort(sorted, sorted + _rttCount);
+
+    *p50 = sorted[(_rttCount - 1) * 50 / 100];
+    *p95 = sorted[(_rttCount - 1) * 95 / 100];
+    *p99 = sorted[(_rttCount - 1) * 99 / 100];
+    return true;
+}
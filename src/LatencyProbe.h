@@ -0,0 +1,69 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <Arduino.h>
+
+// Payload sizes (after the command byte)
+#define PING_PAYLOAD_LEN 11     // seq u16, t1 u32, offset u32, offset_valid u8
+#define PONG_PAYLOAD_LEN 14     // seq u16, t1 u32, t2 u32, t3 u32
+
+// Background ping/pong with the receiver: rolling RTT percentiles and an
+// NTP-style clock offset (receiver clock - controller clock, microseconds).
+// The offset is sent along with each ping so the receiver can turn the
+// timestamp trailer of every data packet into a one-way latency.
+class LatencyProbe {
+public:
+    void begin(uint32_t intervalMs) { _intervalMs = intervalMs; }
+
+    bool due(uint32_t nowMs) const { return _intervalMs && (_pingNow || nowMs - _lastPingMs >= _intervalMs); }
+    void requestPing() { _pingNow = true; }   // Make the next due() true regardless of the interval
+    size_t writePing(uint8_t *payload, uint32_t nowMs);
+    void onPong(const uint8_t *payload, size_t len, uint32_t t4);
+
+    // Rolling RTT percentiles over the last WINDOW pongs, false until the first pong
+    bool percentiles(uint32_t *p50, uint32_t *p95, uint32_t *p99) const;
+    uint32_t lastRttUs() const { return _lastRttUs; }
+    uint32_t lostPings() const { return _sent - _received; }  // Only matched pongs are received
+    bool synced() const { return _synced; }
+    // Synced and measured within OFFSET_MAX_AGE_MS; crystal drift makes older offsets wrong by ms
+    bool offsetFresh(uint32_t nowMs) const { return _synced && nowMs - _offsetMs < OFFSET_MAX_AGE_MS; }
+    uint32_t offsetUs() const { return _offset; }
+
+private:
+    static const uint8_t WINDOW = 128;
+    static const uint8_t FILTER = 8;    // Offset comes from the lowest-RTT of the last FILTER pongs
+    static const uint32_t OFFSET_MAX_AGE_MS = 5000;
+    static const uint8_t PENDING = 8;   // Pings awaiting a pong; older ones count as lost
+
+    struct Sample {
+        uint32_t rtt;
+        uint32_t offset;
+        uint32_t ms;            // millis() when the pong arrived
+    };
+
+    bool matchPending(uint16_t seq);
+
+    uint32_t _intervalMs = 0;
+    uint32_t _lastPingMs = 0;
+    bool _pingNow = false;
+    uint16_t _seq = 0;
+    uint32_t _sent = 0;
+    uint32_t _received = 0;
+    uint16_t _pending[PENDING] = {};   // Seqs of outstanding pings, 0 = free slot
+    uint8_t _pendingHead = 0;
+
+    uint32_t _rtt[WINDOW];
+    uint8_t _rttHead = 0;
+    uint8_t _rttCount = 0;
+    uint32_t _lastRttUs = 0;
+
+    Sample _filter[FILTER];
+    uint8_t _filterHead = 0;
+    uint8_t _filterCount = 0;
+    uint32_t _offset = 0;
+    uint32_t _offsetMs = 0;     // millis() of the sample _offset was taken from
+    uint32_t _lastPongMs = 0;
+    bool _synced = false;
+};
+
+#endif
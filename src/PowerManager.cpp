@@ -0,0 +1,92 @@
+#include "PowerManager.h"
+
+void PowerManager::begin(uint16_t maxMhz, uint16_t idleMhz, bool lightSleep, uint32_t holdoffMs) {
+    _maxMhz = maxMhz;
+    _idleMhz = idleMhz;
+    _holdoffMs = holdoffMs;
+    _held = 0;
+    _atMax = false;
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t cfg = {};
+    cfg.max_freq_mhz = maxMhz;
+    cfg.min_freq_mhz = idleMhz;
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    cfg.light_sleep_enable = lightSleep;
+    _lightSleep = lightSleep;
+#endif
+    if (esp_pm_configure(&cfg) != ESP_OK) {
+        Serial.println("PM: esp_pm_configure failed, CPU clock stays fixed");
+        return;
+    }
+    // One lock for "active"; the individual reasons are only tracked in _held
+    esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "active", &_lock);
+#else
+    // Arduino core built without CONFIG_PM_ENABLE: switch the clock ourselves, no light sleep.
+    // APB stays at 80 MHz for both clocks, so SPI, I2C and UART timing are unaffected.
+    setCpuFrequencyMhz(idleMhz);
+#endif
+
+    _enabled = true;
+    resetStats();
+    Serial.printf("PM: %u MHz while active, %u MHz%s after %lu ms idle\n", maxMhz, idleMhz,
+                  _lightSleep ? " + light sleep" : "", (unsigned long)holdoffMs);
+}
+
+void PowerManager::setMax(bool on) {
+    account();  // Close the current period at the old clock
+    _atMax = on;
+#if CONFIG_PM_ENABLE
+    if (on) esp_pm_lock_acquire(_lock);   // Returns once the clock has switched
+    else esp_pm_lock_release(_lock);
+#else
+    setCpuFrequencyMhz(on ? _maxMhz : _idleMhz);
+#endif
+}
+
+void PowerManager::account() {
+    uint32_t now = micros();
+    uint32_t elapsed = now - _sinceUs;
+    if (_atMax) _stats.maxUs += elapsed;
+    else _stats.idleUs += elapsed;
+    _sinceUs = now;
+}
+
+void PowerManager::acquire(PowerLock lock, uint32_t eventUs) {
+    if (!_enabled) return;
+    _held |= (1 << lock);
+    if (_atMax) return;  // Already active (or still in the hold-off): lock bit only
+
+    uint32_t start = micros();
+    setMax(true);
+    uint32_t wake = micros() - (eventUs ? eventUs : start);
+    _stats.switches++;
+    _stats.lastWakeUs = wake;
+    if (wake > _stats.maxWakeUs) _stats.maxWakeUs = wake;
+}
+
+void PowerManager::release(PowerLock lock) {
+    if (!_enabled || !held(lock)) return;
+    _held &= ~(1 << lock);
+    if (_held == 0) _releasedMs = millis();  // update() drops the clock after the hold-off
+}
+
+uint32_t PowerManager::update() {
+    if (!_enabled || !_atMax || _held) return UINT32_MAX;
+
+    uint32_t idleMs = millis() - _releasedMs;
+    if (idleMs < _holdoffMs) return _holdoffMs - idleMs;
+
+    setMax(false);
+    return UINT32_MAX;
+}
+
+PowerStats PowerManager::stats() {
+    account();
+    return _stats;
+}
+
+void PowerManager::resetStats() {
+    _stats = {};
+    _sinceUs = micros();
+}
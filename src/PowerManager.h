@@ -0,0 +1,70 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "sdkconfig.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+// Why the CPU has to run at full clock; each reason is held or released independently
+enum PowerLock : uint8_t {
+    POWER_LOCK_TOUCH = 0,   // Finger on the screen (from the interrupt until release)
+    POWER_LOCK_RENDER,      // Screen transition or display flush in progress
+    POWER_LOCK_NETWORK,     // Frame just sent or received, WiFi task still busy with it
+    POWER_LOCK_COUNT
+};
+
+// Counters since the last resetStats()
+struct PowerStats {
+    uint64_t maxUs;         // Time at the max clock (locks held or within the hold-off)
+    uint64_t idleUs;        // Time at the idle clock (or in light sleep)
+    uint32_t switches;      // Idle -> max transitions
+    uint32_t lastWakeUs;    // Wake event (e.g. touch interrupt) -> max clock in place
+    uint32_t maxWakeUs;
+};
+
+// Activity-aware CPU clock: max frequency as soon as any PowerLock is taken, the
+// idle frequency (plus automatic light sleep when the ESP-IDF build has tickless
+// idle) once no lock has been held for the hold-off time. Per-frame acquire and
+// release only flip lock bits; the clock changes on the idle <-> active edges.
+// Uses an ESP-IDF power management lock when CONFIG_PM_ENABLE is set, and
+// falls back to setCpuFrequencyMhz() when it is not.
+class PowerManager {
+public:
+    void begin(uint16_t maxMhz, uint16_t idleMhz, bool lightSleep, uint32_t holdoffMs);
+
+    // eventUs: micros() of the event that caused the wake, for the wake latency counter
+    void acquire(PowerLock lock, uint32_t eventUs = 0);
+    void release(PowerLock lock);
+    // Call from the main loop: drops to the idle clock once the hold-off has passed.
+    // Returns the ms until it next needs to run, UINT32_MAX if nothing is pending.
+    uint32_t update();
+
+    bool held(PowerLock lock) const { return _held & (1 << lock); }
+    bool atMax() const { return _atMax; }
+    bool lightSleep() const { return _lightSleep; }
+
+    PowerStats stats();
+    void resetStats();
+
+private:
+    bool _enabled = false;
+    bool _lightSleep = false;
+    uint16_t _maxMhz = 240;
+    uint16_t _idleMhz = 80;
+    uint32_t _holdoffMs = 0;
+    uint8_t _held = 0;          // Bit per PowerLock
+    bool _atMax = false;        // Clock actually at max (lags _held by the hold-off)
+    uint32_t _releasedMs = 0;   // millis() when the last lock was released
+    uint32_t _sinceUs = 0;      // Start of the current max/idle period
+    PowerStats _stats = {};
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t _lock = NULL;
+#endif
+
+    void account();
+    void setMax(bool on);
+};
+
+#endif
@@ -0,0 +1,59 @@
+#include "RadioPolicy.h"
+#include <WiFi.h>
+#include "esp_wifi.h"
+#include "config.h"
+
+void RadioPolicy::begin(uint32_t idleTimeoutMs) {
+    _idleTimeoutMs = idleTimeoutMs;
+    _enabled = true;
+    _awake = false;
+    setLowLatency(false);
+}
+
+void RadioPolicy::setLowLatency(bool on) {
+    if (on) {
+        // Modem sleep delays the first frame after idle until the next DTIM beacon
+        esp_wifi_set_ps(WIFI_PS_NONE);
+        WiFi.setTxPower(WIFI_POWER_19_5dBm);
+    } else {
+        esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+        WiFi.setTxPower(RADIO_IDLE_TX_POWER);
+    }
+}
+
+void RadioPolicy::wake() {
+    _lastActivityMs = millis();
+    if (!_enabled || _awake) return;
+
+    _wakeUs = micros();
+    setLowLatency(true);
+    _awake = true;
+    _waitingFirstSend = true;
+    _wakeCount++;
+}
+
+// Timed to the first send call of any kind (the resync ping goes out right at wake),
+// not to the first command, which for a click only follows when the finger lifts
+void RadioPolicy::onSendAttempt() {
+    if (!_waitingFirstSend) return;
+    _lastWakeToSendUs = micros() - _wakeUs;
+    if (_lastWakeToSendUs > _maxWakeToSendUs) _maxWakeToSendUs = _lastWakeToSendUs;
+    _waitingFirstSend = false;
+}
+
+void RadioPolicy::onPacketSent() {
+    if (!_enabled) return;
+    if (!_awake) wake();  // Send without a touch-down (e.g. timer-driven), still counts as activity
+    _lastActivityMs = millis();
+}
+
+void RadioPolicy::update() {
+    if (!_enabled || !_awake) return;
+    if (millis() - _lastActivityMs < _idleTimeoutMs) return;
+
+    setLowLatency(false);
+    _awake = false;
+    _waitingFirstSend = false;
+    Serial.printf("Radio idle, power save on (wake->first send: %lu us, max %lu us)\n",
+                  (unsigned long)_lastWakeToSendUs, (unsigned long)_maxWakeToSendUs);
+}
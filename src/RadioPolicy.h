@@ -0,0 +1,37 @@
+#ifndef RADIO_POLICY_H
+#define RADIO_POLICY_H
+
+#include <Arduino.h>
+
+// Keeps the WiFi radio fully awake while the user is interacting and lets the
+// ESP32 modem-sleep again once the controller has been idle for a while.
+class RadioPolicy {
+public:
+    void begin(uint32_t idleTimeoutMs);
+    void setIdleTimeout(uint32_t ms) { _idleTimeoutMs = ms; }
+
+    void wake();            // Touch-down: leave power save before any button event fires
+    void onSendAttempt();   // First send call after a wake stops the wake->send timer
+    void onPacketSent();    // Every successful send keeps the radio awake
+    void update();          // Call from the main loop; drops back to power save when idle
+
+    bool isAwake() const { return _awake; }
+    uint32_t lastWakeToSendUs() const { return _lastWakeToSendUs; }
+    uint32_t maxWakeToSendUs() const { return _maxWakeToSendUs; }
+    uint32_t wakeCount() const { return _wakeCount; }
+
+private:
+    bool _enabled = false;
+    bool _awake = false;
+    bool _waitingFirstSend = false;
+    uint32_t _idleTimeoutMs = 0;
+    uint32_t _lastActivityMs = 0;
+    uint32_t _wakeUs = 0;
+    uint32_t _lastWakeToSendUs = 0;
+    uint32_t _maxWakeToSendUs = 0;
+    uint32_t _wakeCount = 0;
+
+    void setLowLatency(bool on);
+};
+
+#endif
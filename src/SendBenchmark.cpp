@@ -0,0 +1,59 @@
+#include "SendBenchmark.h"
+#include "config.h"
+
+static void benchTransport(BleComboWrapper &combo, TransportType type, uint32_t packets) {
+    if (!combo.setTransport(type)) {
+        Serial.printf("%-8s not available\n", combo.transport(type).name());
+        return;
+    }
+    Transport &t = combo.transport();
+
+    // Timed per packet from encode through commit, so the stack-buffer copy of the
+    // wrapper path is charged too. Only successful sends are averaged: on the
+    // non-blocking socket a full TX queue fails fast with EAGAIN/ENOMEM and would
+    // otherwise pull the average down.
+    uint32_t ok = 0, err = 0, maxUs = 0;
+    uint64_t totalUs = 0;
+
+    for (uint32_t i = 0; i < packets; i++) {
+        uint32_t start = micros();
+        bool sent;
+        if (type == TRANSPORT_WIFIUDP) {
+            // Previous path: encode into a stack packet, copy, address the datagram per call
+            uint8_t packet[TRANSPORT_MAX_PACKET];
+            packet[0] = CMD_NOP;
+            packet[1] = (uint8_t)i;
+            packet[2] = (uint8_t)(i >> 8);
+            sent = t.send(packet, 3);
+        } else {
+            uint8_t *p = t.txBuffer();
+            p[0] = CMD_NOP;
+            p[1] = (uint8_t)i;
+            p[2] = (uint8_t)(i >> 8);
+            sent = t.commit(3);
+        }
+        uint32_t elapsed = micros() - start;
+
+        if (sent) {
+            ok++;
+            totalUs += elapsed;
+            if (elapsed > maxUs) maxUs = elapsed;
+        } else {
+            err++;
+        }
+        if ((i & 15) == 15) delay(1);  // Let the WiFi task drain its TX queue
+    }
+
+    uint32_t avg = ok ? (uint32_t)(totalUs / ok) : 0;
+    Serial.printf("%-8s %6lu ok %5lu err  avg %4lu us  max %5lu us  => %lu pkt/s per core\n",
+                  t.name(), (unsigned long)ok, (unsigned long)err,
+                  (unsigned long)avg, (unsigned long)maxUs,
+                  (unsigned long)(avg ? 1000000UL / avg : 0));
+}
+
+void runSendBenchmark(BleComboWrapper &combo, uint32_t packets) {
+    Serial.printf("Send benchmark: %lu packets per transport\n", (unsigned long)packets);
+    benchTransport(combo, TRANSPORT_WIFIUDP, packets);
+    benchTransport(combo, TRANSPORT_UDP, packets);
+    combo.setTransport(DEFAULT_TRANSPORT);
+}
@@ -0,0 +1,10 @@
+#ifndef SEND_BENCHMARK_H
+#define SEND_BENCHMARK_H
+
+#include "BleCombo.h"
+
+// Sends `packets` CMD_NOP frames through the WiFiUDP wrapper and the lwIP socket
+// path and prints per-packet CPU cost. Build with the esp32dev-bench environment.
+void runSendBenchmark(BleComboWrapper &combo, uint32_t packets);
+
+#endif
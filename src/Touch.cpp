@@ -8,6 +8,28 @@ void Touch::begin() {
     Serial.println("Touch I2C initialized on SDA:18, SCL:19");
 }
 
+uint8_t Touch::getTouches(TouchPoint *pts) {
+    // One burst from TD_STATUS (0x02) through P2_YL (0x0C) covers both touch points
+    Wire.beginTransmission(I2C_ADDR);
+    Wire.write(0x02);
+    if (Wire.endTransmission() != 0) return 0;
+
+    uint8_t regs[11];
+    if (Wire.requestFrom(I2C_ADDR, (uint8_t)sizeof(regs)) != sizeof(regs)) return 0;
+    for (uint8_t i = 0; i < sizeof(regs); i++) regs[i] = Wire.read();
+
+    uint8_t touchPoints = regs[0] & 0x0F;
+    if (touchPoints == 0 || touchPoints > MAX_POINTS) return 0;
+
+    // P1 at 0x03..0x06, P2 at 0x09..0x0C (6 registers apart)
+    for (uint8_t i = 0; i < touchPoints; i++) {
+        const uint8_t *p = regs + 1 + i * 6;
+        pts[i].x = ((p[0] & 0x0F) << 8) | p[1];
+        pts[i].y = ((p[2] & 0x0F) << 8) | p[3];
+    }
+    return touchPoints;
+}
+
 bool Touch::getTouch(uint16_t *x, uint16_t *y) {
     // Try to read status register
     Wire.beginTransmission(I2C_ADDR);
@@ -4,11 +4,20 @@
 #include <Arduino.h>
 #include <Wire.h>
 
+// Raw (portrait) controller coordinates
+struct TouchPoint {
+    uint16_t x;
+    uint16_t y;
+};
+
 class Touch {
 public:
+    static const uint8_t MAX_POINTS = 2;  // FT6336 tracks up to two fingers
+
     Touch();
     void begin();
     bool getTouch(uint16_t *x, uint16_t *y);
+    uint8_t getTouches(TouchPoint *pts);  // Fills up to MAX_POINTS, returns count
 
 private:
     static const uint8_t I2C_ADDR = 0x38;
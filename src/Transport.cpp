@@ -0,0 +1,206 @@
+#include "Transport.h"
+#include "lwip/sockets.h"
+#include <errno.h>
+
+/* UDP (lwIP socket) */
+bool UdpTransport::begin(uint32_t ip, uint16_t port) {
+    end();
+    resetStats();
+
+    _fd = lwip_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (_fd < 0) return false;
+
+    // Destination is fixed for the life of the socket, so send() needs no per-packet address setup
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = ip;
+    if (lwip_connect(_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        end();
+        return false;
+    }
+
+    // DSCP EF: the WiFi driver queues these in the WMM voice access category
+    int tos = 0xB8;
+    lwip_setsockopt(_fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+
+    // Never block the UI task on a full TX queue; a dropped move beats a frozen screen
+    lwip_fcntl(_fd, F_SETFL, lwip_fcntl(_fd, F_GETFL, 0) | O_NONBLOCK);
+    return true;
+}
+
+void UdpTransport::end() {
+    if (_fd >= 0) lwip_close(_fd);
+    _fd = -1;
+}
+
+bool UdpTransport::write(uint8_t *frame, size_t len) {
+    return lwip_send(_fd, frame, len, 0) == (ssize_t)len;
+}
+
+size_t UdpTransport::receive(uint8_t *buf, size_t maxLen) {
+    if (_fd < 0) return 0;
+    // Connected socket: only datagrams from the receiver's address arrive here
+    int n = lwip_recv(_fd, buf, maxLen, MSG_DONTWAIT);
+    return n > 0 ? (size_t)n : 0;
+}
+
+/* WiFiUDP */
+bool WiFiUdpTransport::begin(uint32_t ip, uint16_t port) {
+    _ip = ip;
+    _port = port;
+    _started = _udp.begin(0);  // Use any available port for sending
+    resetStats();
+    return _started;
+}
+
+void WiFiUdpTransport::end() {
+    _udp.stop();
+    _started = false;
+}
+
+bool WiFiUdpTransport::write(uint8_t *frame, size_t len) {
+    if (!_started) return false;
+    if (!_udp.beginPacket(_ip, _port)) return false;
+    _udp.write(frame, len);
+    return _udp.endPacket() == 1;
+}
+
+size_t WiFiUdpTransport::receive(uint8_t *buf, size_t maxLen) {
+    if (!_started || _udp.parsePacket() <= 0) return 0;
+    int n = _udp.read(buf, maxLen);
+    return n > 0 ? (size_t)n : 0;
+}
+
+/* TCP */
+bool TcpTransport::begin(uint32_t ip, uint16_t port) {
+    _ip = ip;
+    _port = port;
+    _started = true;
+    resetStats();
+    startConnect();
+    return _state == CONNECTED;
+}
+
+void TcpTransport::end() {
+    close();
+    _started = false;
+}
+
+void TcpTransport::close() {
+    if (_fd >= 0) lwip_close(_fd);
+    _fd = -1;
+    _state = IDLE;
+    _rxLen = 0;
+}
+
+void TcpTransport::startConnect() {
+    close();
+    _lastAttemptMs = millis();
+
+    _fd = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (_fd < 0) return;
+
+    // Non-blocking before connect(): the handshake completes in the background
+    // and pollConnect() picks up the result, so the UI task never waits on it
+    lwip_fcntl(_fd, F_SETFL, lwip_fcntl(_fd, F_GETFL, 0) | O_NONBLOCK);
+
+    int one = 1;
+    lwip_setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // Every frame is a user action
+    int tos = 0xB8;
+    lwip_setsockopt(_fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(_port);
+    addr.sin_addr.s_addr = _ip;
+    if (lwip_connect(_fd, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+        _state = CONNECTED;
+    } else if (errno == EINPROGRESS) {
+        _state = CONNECTING;
+    } else {
+        close();
+    }
+}
+
+bool TcpTransport::pollConnect() {
+    fd_set wr;
+    FD_ZERO(&wr);
+    FD_SET(_fd, &wr);
+    struct timeval tv = {0, 0};
+    int n = lwip_select(_fd + 1, NULL, &wr, NULL, &tv);
+
+    if (n == 0) {
+        // Handshake still in flight; give up on it after a while and retry later
+        if (millis() - _lastAttemptMs >= CONNECT_TIMEOUT_MS) close();
+        return false;
+    }
+
+    int err = 0;
+    socklen_t errLen = sizeof(err);
+    if (n < 0 || lwip_getsockopt(_fd, SOL_SOCKET, SO_ERROR, &err, &errLen) < 0 || err != 0) {
+        close();
+        return false;
+    }
+
+    _state = CONNECTED;
+    Serial.printf("TCP transport connected to %u.%u.%u.%u:%u\n",
+                  _ip & 0xFF, (_ip >> 8) & 0xFF, (_ip >> 16) & 0xFF, _ip >> 24, _port);
+    return true;
+}
+
+// Connection upkeep runs from the main loop, never from connected() or write(), so
+// a send while the receiver is down costs a state check and nothing else
+void TcpTransport::poll() {
+    if (_state == CONNECTING) {
+        pollConnect();
+    } else if (_state == IDLE && _started && millis() - _lastAttemptMs >= RECONNECT_INTERVAL_MS) {
+        // Receiver restarted or network dropped: start a new attempt now and then
+        startConnect();
+    }
+}
+
+bool TcpTransport::write(uint8_t *frame, size_t len) {
+    if (_state != CONNECTED) return false;
+
+    // Length prefix goes into the headroom in front of the frame, so header and
+    // payload leave in a single write (and segment) without copying
+    frame[-1] = (uint8_t)len;
+    int n = lwip_send(_fd, frame - 1, len + 1, 0);
+    if (n == (int)len + 1) return true;
+
+    // Send buffer full: drop this frame, the stream itself is still in sync
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return false;
+
+    // Partial frame or socket error: the receiver can no longer find frame boundaries
+    close();
+    return false;
+}
+
+size_t TcpTransport::receive(uint8_t *buf, size_t maxLen) {
+    if (_state != CONNECTED) return 0;
+
+    if (_rxLen < sizeof(_rx)) {
+        int n = lwip_recv(_fd, _rx + _rxLen, sizeof(_rx) - _rxLen, MSG_DONTWAIT);
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+            close();  // Receiver closed the connection
+            return 0;
+        }
+        if (n > 0) _rxLen += n;
+    }
+
+    // Only hand out a frame once it has fully arrived
+    if (_rxLen < 1) return 0;
+    size_t len = _rx[0];
+    if (len > TRANSPORT_MAX_PACKET) {
+        close();  // Not a frame we ever send back; the stream is out of sync
+        return 0;
+    }
+    if (_rxLen < len + 1) return 0;
+
+    size_t n = len <= maxLen ? len : 0;
+    memcpy(buf, _rx + 1, n);
+    _rxLen -= len + 1;
+    memmove(_rx, _rx + 1 + len, _rxLen);
+    return n;
+}
@@ -0,0 +1,83 @@
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+#include "TransportBase.h"
+
+/* UDP: lwIP socket connected once in begin(), each command is a bare send() */
+class UdpTransport : public Transport {
+public:
+    const char *name() const override { return "UDP"; }
+    bool begin(uint32_t ip, uint16_t port) override;
+    void end() override;
+    bool connected() override { return _fd >= 0; }
+    size_t receive(uint8_t *buf, size_t maxLen) override;
+    int fd() const override { return _fd; }
+
+protected:
+    bool write(uint8_t *frame, size_t len) override;
+
+private:
+    int _fd = -1;
+};
+
+/* WiFiUDP: one datagram per command through the Arduino wrapper (address setup per packet) */
+class WiFiUdpTransport : public Transport {
+public:
+    const char *name() const override { return "WiFiUDP"; }
+    bool begin(uint32_t ip, uint16_t port) override;
+    void end() override;
+    bool connected() override { return _started; }
+    size_t receive(uint8_t *buf, size_t maxLen) override;
+
+protected:
+    bool write(uint8_t *frame, size_t len) override;
+
+private:
+    WiFiUDP _udp;
+    IPAddress _ip;
+    uint16_t _port = 0;
+    bool _started = false;
+};
+
+/* TCP: persistent connection with Nagle disabled, frames are [len][cmd][payload].
+   Raw non-blocking lwIP socket: connecting and reconnecting never stall the caller. */
+class TcpTransport : public Transport {
+public:
+    const char *name() const override { return "TCP"; }
+    bool begin(uint32_t ip, uint16_t port) override;
+    void end() override;
+    bool connected() override { return _state == CONNECTED; }
+    void poll() override;
+    size_t receive(uint8_t *buf, size_t maxLen) override;
+    int fd() const override { return _fd; }   // Also while CONNECTING, see wantsWrite()
+    bool wantsWrite() const override { return _state == CONNECTING; }
+
+protected:
+    bool write(uint8_t *frame, size_t len) override;
+
+private:
+    static const uint32_t CONNECT_TIMEOUT_MS = 1000;
+    static const uint32_t RECONNECT_INTERVAL_MS = 2000;
+
+    enum State : uint8_t { IDLE, CONNECTING, CONNECTED };
+
+    int _fd = -1;
+    State _state = IDLE;
+    uint32_t _ip = 0;           // Network byte order
+    uint16_t _port = 0;
+    bool _started = false;
+    uint32_t _lastAttemptMs = 0;
+
+    // Stream reassembly: holds at most one [len][frame] that arrived in pieces
+    uint8_t _rx[1 + TRANSPORT_MAX_PACKET];
+    uint8_t _rxLen = 0;
+
+    void startConnect();
+    bool pollConnect();
+    void close();
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "TransportBase.h"
+
+/* Common counters */
+bool Transport::send(const uint8_t *data, size_t len) {
+    if (len > TRANSPORT_MAX_PACKET) {
+        _stats.errors++;
+        return false;
+    }
+    memcpy(txBuffer(), data, len);
+    return commit(len);
+}
+
+bool Transport::commit(size_t len) {
+    if (len == 0 || len > TRANSPORT_MAX_PACKET) {
+        _stats.errors++;
+        return false;
+    }
+
+    uint32_t start = micros();
+    bool ok = write(txBuffer(), len);
+    uint32_t elapsed = micros() - start;
+
+    _stats.lastSendUs = elapsed;
+    if (elapsed > _stats.maxSendUs) _stats.maxSendUs = elapsed;
+    _stats.totalSendUs += elapsed;
+
+    if (ok) {
+        _stats.packets++;
+        _stats.bytes += len;
+    } else {
+        _stats.errors++;
+    }
+    return ok;
+}
+
+void Transport::resetStats() {
+    _stats = {};
+    _stats.startMs = millis();
+}
+
+uint32_t Transport::avgSendUs() const {
+    uint32_t calls = _stats.packets + _stats.errors;
+    return calls ? (uint32_t)(_stats.totalSendUs / calls) : 0;
+}
+
+uint32_t Transport::bytesPerSec() const {
+    uint32_t elapsed = millis() - _stats.startMs;
+    return elapsed ? (uint32_t)((uint64_t)_stats.bytes * 1000 / elapsed) : 0;
+}
+
+/* Loopback */
+bool LoopbackTransport::begin(uint32_t ip, uint16_t port) {
+    _head = _tail = 0;
+    resetStats();
+    return true;
+}
+
+size_t LoopbackTransport::available() const {
+    return (uint8_t)(_head - _tail + SLOTS) % SLOTS;
+}
+
+size_t LoopbackTransport::read(uint8_t *out, size_t maxLen) {
+    if (_head == _tail) return 0;
+
+    const Frame &f = _ring[_tail];
+    size_t n = f.len < maxLen ? f.len : maxLen;
+    memcpy(out, f.data, n);
+    _tail = (_tail + 1) % SLOTS;
+    return n;
+}
+
+bool LoopbackTransport::write(uint8_t *frame, size_t len) {
+    uint8_t next = (_head + 1) % SLOTS;
+    if (next == _tail) return false;  // Reader is behind, drop rather than overwrite
+
+    Frame &f = _ring[_head];
+    f.len = (uint8_t)len;
+    memcpy(f.data, frame, len);
+    _head = next;
+    return true;
+}
@@ -0,0 +1,116 @@
+#ifndef TRANSPORT_BASE_H
+#define TRANSPORT_BASE_H
+
+// Transport interface and the loopback backend. Kept free of WiFi and Arduino
+// networking headers so the command path also builds for the native test env.
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+// Supplied by the host test harness
+uint32_t micros();
+uint32_t millis();
+#endif
+
+// Largest command frame (cmd byte + payload) any backend has to carry
+#define TRANSPORT_MAX_PACKET 32
+// Bytes reserved in front of the frame buffer for backend headers (TCP length prefix)
+#define TRANSPORT_HEADROOM 1
+
+// Transport backends, selectable at runtime via BleComboWrapper::setTransport()
+enum TransportType : uint8_t {
+    TRANSPORT_UDP = 0,      // Datagram per command on a pre-connected lwIP socket (default)
+    TRANSPORT_TCP,          // Persistent TCP_NODELAY stream, length-prefixed frames
+    TRANSPORT_LOOPBACK,     // In-process ring buffer for host tests
+    TRANSPORT_WIFIUDP,      // Datagram per command through the Arduino WiFiUDP wrapper
+    TRANSPORT_COUNT
+};
+
+// Per-backend latency and throughput counters
+struct TransportStats {
+    uint32_t packets;       // Frames handed to the network successfully
+    uint32_t bytes;         // Payload bytes in those frames
+    uint32_t errors;        // Failed sends (not connected, socket error, ring full)
+    uint32_t lastSendUs;    // Duration of the most recent send call
+    uint32_t maxSendUs;     // Worst send call since reset
+    uint64_t totalSendUs;   // Sum of all send call durations
+    uint32_t startMs;       // millis() at last reset, for throughput
+};
+
+class Transport {
+public:
+    virtual ~Transport() {}
+
+    virtual const char *name() const = 0;
+    // ip is in network byte order, as held by IPAddress
+    virtual bool begin(uint32_t ip, uint16_t port) = 0;
+    virtual void end() {}
+    // Pure state check, cheap enough for every send
+    virtual bool connected() = 0;
+    virtual bool needsWiFi() const { return true; }
+
+    // Housekeeping (connection upkeep), called from the main loop rather than the send path
+    virtual void poll() {}
+
+    // Zero-copy send: encode the frame straight into txBuffer(), then commit() it
+    uint8_t *txBuffer() { return _tx + TRANSPORT_HEADROOM; }
+    bool commit(size_t len);
+
+    // Copying convenience wrapper around txBuffer()/commit()
+    bool send(const uint8_t *data, size_t len);
+
+    // Non-blocking: copies one frame from the receiver into buf, returns its length or 0
+    virtual size_t receive(uint8_t *buf, size_t maxLen) { return 0; }
+
+    // lwIP socket that becomes readable when a frame arrives, -1 if there is none to wait on
+    virtual int fd() const { return -1; }
+    // fd() becomes writable when poll() has work to do (a non-blocking connect finished)
+    virtual bool wantsWrite() const { return false; }
+
+    const TransportStats &stats() const { return _stats; }
+    void resetStats();
+    uint32_t avgSendUs() const;
+    uint32_t bytesPerSec() const;
+
+protected:
+    // Always called with txBuffer(); TRANSPORT_HEADROOM bytes before it are writable
+    virtual bool write(uint8_t *frame, size_t len) = 0;
+
+    TransportStats _stats = {};
+
+private:
+    uint8_t _tx[TRANSPORT_HEADROOM + TRANSPORT_MAX_PACKET];
+};
+
+/* Loopback: frames stay in a fixed ring buffer and can be read back in-process */
+class LoopbackTransport : public Transport {
+public:
+    const char *name() const override { return "LOOP"; }
+    bool begin(uint32_t ip, uint16_t port) override;
+    void end() override { _head = _tail = 0; }
+    bool connected() override { return true; }
+    bool needsWiFi() const override { return false; }
+
+    size_t available() const;
+    size_t read(uint8_t *out, size_t maxLen);   // Pops the oldest frame, returns its length
+
+protected:
+    bool write(uint8_t *frame, size_t len) override;
+
+private:
+    static const uint8_t SLOTS = 16;
+
+    struct Frame {
+        uint8_t len;
+        uint8_t data[TRANSPORT_MAX_PACKET];
+    };
+
+    Frame _ring[SLOTS];
+    uint8_t _head = 0;  // Next slot to write
+    uint8_t _tail = 0;  // Next slot to read
+};
+
+#endif
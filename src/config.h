@@ -7,5 +7,49 @@
 #define WIFI_PASSWORD "Mpi2h4u2c!"  // Replace with your WiFi password
 #define PC_IP_ADDRESS "192.168.178.116"       // Replace with your PC's IP address
 #define UDP_PORT 5006                        // Must match Python receiver port
+#define TCP_PORT 5006                        // TCP listener on the receiver (same number, separate protocol)
+
+// Transport used after boot: TRANSPORT_UDP, TRANSPORT_TCP or TRANSPORT_LOOPBACK
+// Switch at runtime by long-pressing the status text in the header
+#define DEFAULT_TRANSPORT TRANSPORT_UDP
+
+// Radio power policy: full power, no modem sleep while the user interacts,
+// back to power save after this much inactivity
+#define RADIO_IDLE_TIMEOUT_MS 30000
+#define RADIO_IDLE_TX_POWER   WIFI_POWER_15dBm
+
+// Ping/pong with the receiver while the user interacts (RTT and clock offset).
+// Tap the status text in the header to see p50/p95/p99 RTT. 0 disables the probe.
+#define LATENCY_PROBE_INTERVAL_MS 1000
+
+// FT6336 touch interrupt (WT32-SC01: GPIO 39). The main loop sleeps until this
+// fires instead of polling the touch controller; -1 falls back to polling.
+#define TOUCH_INT_PIN 39
+
+// Touch reads that keep running after release before polling stops (LVGL's read
+// period is 30 ms), so release gestures and scroll throw still get their samples.
+// Polling also continues while a scroll or throw is in progress.
+#define TOUCH_RELEASE_GRACE_READS 4
+
+// Print main loop wakeups/s and touch-interrupt -> input latency every N ms (0 = off)
+#define LOOP_STATS_INTERVAL_MS 10000
+
+// CPU clock: CPU_FREQ_MAX_MHZ while touched, rendering or sending, CPU_FREQ_IDLE_MHZ
+// (plus automatic light sleep if the ESP-IDF build has tickless idle) otherwise.
+// Keep the idle clock at 80 MHz or above so APB (SPI, I2C, UART) timing never changes.
+// CPU_FREQ_IDLE_MHZ 0 keeps a fixed clock.
+#define CPU_FREQ_MAX_MHZ   240
+#define CPU_FREQ_IDLE_MHZ  80
+#define CPU_LIGHT_SLEEP    true
+#define POWER_NET_HOLD_MS  20   // Full clock this long after a send, while the WiFi task transmits
+#define POWER_IDLE_HOLDOFF_MS 100 // Stay at full clock this long after the last lock is released
+
+// Touchpad tablet (absolute) mode: this screen rectangle maps onto the whole
+// receiver monitor. Default is the full touchpad area; shrink it for finer control.
+#define TABLET_MODE_DEFAULT false
+#define TABLET_AREA_X 10
+#define TABLET_AREA_Y 50
+#define TABLET_AREA_W 460
+#define TABLET_AREA_H 190
 
 #endif
@@ -1,146 +1,429 @@
+// Generated by convert_img.py from download.png - do not edit
+// Source hash: 82e2e84802245b907f37f77f8ddc8b6cb8d7d9bc
 #include <pgmspace.h>
+#include "ImageStream.h"
 
-const uint8_t gspro_logo[] PROGMEM = {
-  0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x08, 0x03, 0x00, 0x00, 0x00, 0x2D, 0xF3, 0x9A, 
-  0xD3, 0x00, 0x00, 0x00, 0xB1, 0x50, 0x4C, 0x54, 0x45, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0x00, 
-  0x00, 0x00, 0x1A, 0x81, 0xCA, 0x10, 0x0F, 0x0D, 0x0F, 0x00, 0x00, 0x1B, 0x7D, 0xC3, 0x10, 0x12, 
-  0x11, 0x11, 0x0E, 0x06, 0x11, 0x1E, 0x29, 0x17, 0x60, 0x94, 0x17, 0x57, 0x84, 0x1A, 0x81, 0xC8, 
-  0x10, 0x1A, 0x21, 0xF6, 0xF6, 0xF6, 0x0A, 0x0A, 0x0A, 0x10, 0x07, 0x00, 0x18, 0x73, 0xB3, 0xE4, 
-  0xE4, 0xE4, 0x22, 0x22, 0x22, 0x13, 0x26, 0x38, 0x4C, 0x4C, 0x4C, 0x31, 0x31, 0x31, 0xDA, 0xDA, 
-  0xDA, 0x12, 0x2F, 0x45, 0x5F, 0x5F, 0x5F, 0x12, 0x28, 0x38, 0xB2, 0xB2, 0xB2, 0xBC, 0xBC, 0xBC, 
-  0x1A, 0x84, 0xCF, 0x83, 0x83, 0x83, 0x18, 0x69, 0xA3, 0x1B, 0x1B, 0x1B, 0xD1, 0xD1, 0xD1, 0xF0, 
-  0xF0, 0xF0, 0x14, 0x42, 0x61, 0x67, 0x67, 0x67, 0x33, 0x33, 0x33, 0x7B, 0x7B, 0x7B, 0x97, 0x97, 
-  0x97, 0xCC, 0xCC, 0xCC, 0x8C, 0x8C, 0x8C, 0x29, 0x29, 0x29, 0x40, 0x40, 0x40, 0x93, 0x93, 0x93, 
-  0x13, 0x37, 0x52, 0xA9, 0xA9, 0xA9, 0x7F, 0x7F, 0x7F, 0x52, 0x52, 0x52, 0x6F, 0x6F, 0x6F, 0xA0, 
-  0xA0, 0xA0, 0x16, 0x4E, 0x77, 0x11, 0x16, 0x1A, 0x19, 0x75, 0xB7, 0x15, 0x51, 0x7C, 0x12, 0x25, 
-  0x33, 0x14, 0x43, 0x65, 0x3B, 0x3B, 0x3B, 0x59, 0x59, 0x59, 0x0E, 0x31, 0xA5, 0x87, 0x00, 0x00, 
-  0x07, 0xBA, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9C, 0xED, 0x9D, 0x6D, 0x77, 0xA2, 0xBA, 0x16, 0x80, 
-  0x4D, 0xC4, 0xD1, 0xF6, 0x74, 0x88, 0x85, 0x11, 0xC6, 0x8A, 0x0A, 0x8C, 0xCA, 0x9B, 0x43, 0xD5, 
-  0x99, 0x73, 0x6E, 0xF5, 0xFF, 0xFF, 0xB0, 0xBB, 0x13, 0x50, 0x0B, 0x06, 0x5B, 0x5B, 0xCF, 0xF4, 
-  0xEC, 0xAE, 0xFD, 0xAC, 0xD5, 0x35, 0x4A, 0x92, 0x6D, 0x1E, 0xF2, 0xCE, 0x07, 0xA6, 0xD5, 0x22, 
-  0x08, 0x82, 0x20, 0x08, 0x82, 0xF8, 0x14, 0x18, 0x9F, 0x87, 0x06, 0xC3, 0xEE, 0xA7, 0x40, 0xB5, 
-  0x95, 0xC6, 0xAE, 0xFF, 0xEB, 0xCB, 0xE7, 0xA1, 0xA7, 0x31, 0xEC, 0xFC, 0x75, 0xFB, 0xFB, 0xE6, 
-  0x73, 0xF0, 0xAD, 0xAD, 0xEB, 0xA4, 0x20, 0xD8, 0xF9, 0xE8, 0xA1, 0x73, 0x1D, 0xFA, 0x37, 0x77, 
-  0x4D, 0x82, 0xAF, 0x9F, 0x90, 0xFE, 0xCB, 0x18, 0x37, 0x8D, 0x2D, 0xF8, 0xE7, 0x2B, 0xF3, 0x6F, 
-  0x60, 0x7C, 0xFE, 0x16, 0x24, 0x41, 0xDC, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 
-  0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x43, 0x82, 0xD8, 0x21, 0x41, 0xEC, 0x90, 0x20, 
-  0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x43, 
-  0x82, 0xD8, 0x21, 0x41, 0xEC, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 0xC4, 
-  0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x43, 0x82, 0xD8, 0x21, 0x41, 0xEC, 0x90, 0x20, 0x76, 0x48, 
-  0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x43, 0x82, 0xD8, 
-  0x21, 0x41, 0xEC, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 0xC4, 0x0E, 0x09, 
-  0x62, 0xE7, 0x62, 0xC1, 0xC6, 0x57, 0x24, 0xFD, 0x47, 0xB9, 0x48, 0xD0, 0xE8, 0x77, 0x3A, 0x7D, 
-  0x2D, 0xE5, 0x5B, 0x85, 0x9A, 0xD2, 0x7B, 0x32, 0x51, 0xF0, 0x66, 0xC4, 0x4B, 0x19, 0x78, 0x59, 
-  0x85, 0x33, 0x79, 0xC4, 0xBB, 0x05, 0x0D, 0xE3, 0xD7, 0xF4, 0x5E, 0xFF, 0xDA, 0xA4, 0x69, 0x47, 
-  0xF9, 0xFF, 0xB8, 0xD5, 0xA7, 0xCB, 0x60, 0x7C, 0x60, 0x36, 0x60, 0x05, 0x1B, 0x07, 0x04, 0x84, 
-  0x1D, 0x36, 0x64, 0x08, 0x5D, 0x6F, 0xBD, 0xBF, 0x07, 0x93, 0xD8, 0xD2, 0xC6, 0x88, 0x93, 0x96, 
-  0xD6, 0xF0, 0x02, 0x41, 0xE3, 0xF7, 0xFD, 0xB8, 0xDD, 0x6E, 0xDF, 0xB5, 0x35, 0x28, 0xC1, 0xFE, 
-  0xED, 0x58, 0x9F, 0x3A, 0x2E, 0x04, 0xD9, 0x19, 0x32, 0x0E, 0x82, 0xE7, 0x32, 0x8C, 0x64, 0x1B, 
-  0x0A, 0xE1, 0x36, 0xE7, 0xB0, 0x84, 0xCE, 0xF0, 0x02, 0xC1, 0xFE, 0x2F, 0xE9, 0xD7, 0xBE, 0x1B, 
-  0x6B, 0x90, 0x82, 0xC6, 0xCD, 0xB8, 0xF0, 0x39, 0x91, 0xBC, 0x7B, 0x59, 0x30, 0x7E, 0x49, 0x90, 
-  0xED, 0xC0, 0x90, 0x3F, 0x9E, 0xCB, 0xB1, 0xE4, 0xA7, 0x22, 0x97, 0x08, 0x76, 0x6E, 0x95, 0xC0, 
-  0xF4, 0xE7, 0xF7, 0x53, 0x1E, 0x20, 0x46, 0xFF, 0xA7, 0x4A, 0xBF, 0xFD, 0x5D, 0x8F, 0x57, 0xBC, 
-  0xDE, 0xAC, 0x14, 0x74, 0xB9, 0x5D, 0x61, 0x1E, 0x15, 0xB7, 0xFF, 0x20, 0x68, 0x76, 0xAB, 0x19, 
-  0xEC, 0x59, 0xA8, 0xAE, 0x4F, 0xA4, 0x60, 0xAE, 0x3E, 0x7A, 0x4E, 0xF5, 0x07, 0xD2, 0x51, 0x71, 
-  0xF9, 0xDD, 0x82, 0xAA, 0xBB, 0xFD, 0xE8, 0xF4, 0x34, 0xC8, 0x16, 0xFE, 0x31, 0x86, 0xB6, 0x1B, 
-  0x3F, 0xF5, 0x35, 0xEF, 0xC6, 0x7A, 0x2E, 0x28, 0x2A, 0x70, 0xDF, 0xAC, 0x09, 0xD6, 0x32, 0x08, 
-  0xEE, 0x1D, 0x05, 0x0B, 0x93, 0x61, 0x3D, 0xC6, 0xEC, 0xAA, 0x82, 0x7D, 0x4D, 0x98, 0x56, 0x21, 
-  0x78, 0x2E, 0xFD, 0x20, 0x58, 0xBD, 0x2C, 0xEC, 0x13, 0xC1, 0x7A, 0x41, 0x8D, 0x60, 0x2D, 0xC7, 
-  0x9F, 0x15, 0x3C, 0x7D, 0x21, 0x1B, 0x6E, 0x41, 0xB9, 0x38, 0x76, 0x3A, 0xC6, 0x5E, 0xB0, 0x3D, 
-  0x7D, 0xA8, 0x71, 0x63, 0xF4, 0x2B, 0x5D, 0xF4, 0x45, 0xC1, 0xDA, 0x64, 0xF8, 0xC1, 0x82, 0xBD, 
-  0xEF, 0x53, 0xC9, 0x57, 0xA3, 0xD5, 0xFB, 0x36, 0xD6, 0x4E, 0xA2, 0x77, 0x7F, 0xFF, 0x23, 0xF7, 
-  0x01, 0xAF, 0x17, 0xAC, 0x53, 0x2C, 0x0D, 0xEB, 0x8F, 0x12, 0x84, 0xB9, 0xF3, 0xEE, 0x6E, 0xFC, 
-  0xD5, 0x50, 0xEB, 0xE0, 0x58, 0xB7, 0x0C, 0x56, 0xD6, 0xC1, 0xC6, 0x49, 0x46, 0xEC, 0x05, 0x07, 
-  0x56, 0x15, 0xB3, 0xAC, 0xBD, 0xF8, 0x18, 0xC1, 0x62, 0x71, 0x50, 0x82, 0x46, 0xFF, 0xE7, 0x5F, 
-  0xD3, 0x1A, 0xF7, 0xCA, 0xF0, 0x0B, 0x74, 0xD2, 0x83, 0xE0, 0xDC, 0x79, 0xCE, 0x76, 0x53, 0x5B, 
-  0x26, 0xC2, 0x1D, 0xD3, 0x10, 0xCE, 0x64, 0xED, 0x3F, 0x58, 0x10, 0x9A, 0xB3, 0x53, 0xA7, 0xAF, 
-  0x0C, 0xE5, 0x1B, 0x30, 0xF7, 0x82, 0x0B, 0x5D, 0xFD, 0x9F, 0x2D, 0xF4, 0xE1, 0x8A, 0x55, 0x77, 
-  0x61, 0x65, 0x8E, 0xD1, 0x07, 0x75, 0xD1, 0x8A, 0xA0, 0x26, 0xD0, 0xB4, 0x26, 0x18, 0x68, 0x05, 
-  0xCD, 0xAC, 0x79, 0x1D, 0xF4, 0x97, 0xE5, 0xF5, 0x3F, 0x24, 0xF8, 0x74, 0x3A, 0x06, 0x2F, 0x11, 
-  0x74, 0xD7, 0xB5, 0x06, 0x32, 0x43, 0xD8, 0x6C, 0xCF, 0xD5, 0x66, 0x5B, 0x2F, 0xC8, 0x9D, 0x3F, 
-  0x2C, 0xD8, 0x31, 0x0E, 0xFB, 0x17, 0xA3, 0x67, 0x3C, 0x1F, 0x83, 0x46, 0x6D, 0x7B, 0x63, 0xF4, 
-  0xFA, 0xA7, 0x82, 0x8D, 0x47, 0x9D, 0xA6, 0x75, 0x50, 0x6C, 0x4F, 0x05, 0x6B, 0x0C, 0xAF, 0x28, 
-  0x78, 0x37, 0xFD, 0xFE, 0xED, 0xC8, 0xC3, 0xC3, 0xFF, 0x9E, 0xDA, 0xA5, 0xA0, 0xF1, 0xF5, 0x5B, 
-  0x9D, 0x87, 0x87, 0xA7, 0x2F, 0x27, 0x93, 0x8C, 0xA6, 0x16, 0x85, 0xC8, 0x2B, 0x04, 0x8B, 0xBD, 
-  0x68, 0x30, 0x1B, 0x56, 0x58, 0xC7, 0x57, 0x11, 0xEC, 0x3F, 0xC9, 0xBD, 0xE6, 0xC9, 0x69, 0xA2, 
-  0xBD, 0x17, 0x84, 0x74, 0x0D, 0x2A, 0xF9, 0xBE, 0xD3, 0xB8, 0x0E, 0x5E, 0x26, 0xB8, 0xD6, 0xCE, 
-  0x50, 0x25, 0xC9, 0x3B, 0x05, 0x0D, 0x63, 0xAA, 0x5F, 0xE6, 0x8E, 0x82, 0x0D, 0x89, 0x5F, 0xBE, 
-  0xF7, 0x5E, 0x23, 0x98, 0xBE, 0x28, 0x28, 0x78, 0xDC, 0xEC, 0x17, 0x68, 0xCF, 0xF4, 0x17, 0x9D, 
-  0xE8, 0xE1, 0xC4, 0x3E, 0xBD, 0xD7, 0x23, 0x77, 0x32, 0x3F, 0xFF, 0xD6, 0x26, 0xDD, 0xFE, 0xFA, 
-  0x2D, 0xE7, 0x25, 0x5E, 0x2C, 0xE0, 0xDA, 0x7E, 0x54, 0x88, 0xD8, 0x2A, 0xC3, 0xC9, 0x1D, 0x10, 
-  0xF3, 0xE3, 0x75, 0x38, 0x38, 0x8C, 0x02, 0x4B, 0x43, 0xB0, 0x3F, 0xF3, 0xBF, 0x47, 0xB0, 0xD8, 
-  0x76, 0xEA, 0x1F, 0xCA, 0xC8, 0x18, 0x3D, 0x5D, 0x82, 0x2C, 0x51, 0xFC, 0x80, 0xA8, 0x3C, 0x5C, 
-  0xD1, 0x19, 0x36, 0x64, 0xA8, 0x5C, 0x7F, 0xF1, 0xA9, 0xCD, 0x7B, 0x04, 0x31, 0x42, 0x82, 0xD8, 
-  0x21, 0x41, 0xEC, 0xBC, 0x55, 0xB0, 0x3A, 0x6B, 0xA9, 0x2F, 0xFC, 0xF8, 0x80, 0x5A, 0x1E, 0xDD, 
-  0xB4, 0xB3, 0xB6, 0x38, 0x37, 0x8B, 0x1E, 0x0B, 0x3F, 0xFF, 0x19, 0xFD, 0x03, 0xEB, 0x57, 0xF3, 
-  0x36, 0x41, 0xCE, 0x57, 0x8F, 0xBB, 0x63, 0x5D, 0xF9, 0x12, 0x36, 0x11, 0x7C, 0x1D, 0x8F, 0x52, 
-  0x69, 0x36, 0x5F, 0xAC, 0x6D, 0xCE, 0x67, 0xB9, 0x7D, 0x5A, 0x35, 0xE1, 0x8F, 0x76, 0xC7, 0x52, 
-  0x1A, 0x57, 0xEE, 0xAF, 0x17, 0xCE, 0xF1, 0xBA, 0x8C, 0x69, 0xBF, 0x74, 0x4F, 0xCE, 0xF3, 0x26, 
-  0x41, 0xBE, 0xB5, 0x60, 0xE7, 0x10, 0x0E, 0xD4, 0xD2, 0x2B, 0xBF, 0xBB, 0x01, 0x87, 0x8D, 0x8A, 
-  0xEB, 0x39, 0xA2, 0xDC, 0x2E, 0xE6, 0x3C, 0x32, 0xE7, 0xF2, 0x49, 0xB3, 0x28, 0xB3, 0x28, 0xE4, 
-  0xA1, 0x7D, 0x72, 0x28, 0x54, 0x2E, 0xE9, 0xFB, 0x54, 0x75, 0x2D, 0x91, 0x85, 0xE3, 0x43, 0x16, 
-  0x88, 0x19, 0xFB, 0xA1, 0x3C, 0x2B, 0x56, 0xA2, 0x14, 0xD9, 0x45, 0x25, 0xF6, 0x35, 0x05, 0x85, 
-  0xB0, 0xCC, 0x99, 0xBD, 0x33, 0x03, 0x68, 0x36, 0xEE, 0xC3, 0x0D, 0x56, 0x82, 0x13, 0x66, 0x43, 
-  0x77, 0x82, 0x3A, 0xE5, 0xF6, 0x7C, 0x93, 0x70, 0xDF, 0x91, 0x27, 0x1D, 0xDE, 0xE5, 0xF2, 0xAF, 
-  0xA8, 0x0D, 0x7C, 0x95, 0x82, 0xE2, 0x58, 0x48, 0x94, 0x01, 0x54, 0x12, 0x64, 0xEA, 0xB2, 0xD8, 
-  0x4E, 0x27, 0xB9, 0x8C, 0xDB, 0x95, 0x59, 0x16, 0x0C, 0x3E, 0xC9, 0xCD, 0x8F, 0x90, 0x1B, 0x51, 
-  0xDE, 0x15, 0x32, 0x45, 0x25, 0xC9, 0xD8, 0x7E, 0x19, 0xE9, 0xEA, 0x82, 0xE0, 0x32, 0x84, 0x6A, 
-  0x6E, 0x53, 0xC1, 0x17, 0x21, 0x33, 0x37, 0x5C, 0xD6, 0x75, 0x5D, 0x6C, 0xE7, 0xE1, 0x68, 0x36, 
-  0x51, 0xFB, 0x8A, 0x88, 0x39, 0x03, 0x96, 0x98, 0x2C, 0x58, 0x59, 0xCC, 0x72, 0xB8, 0xEB, 0xC9, 
-  0x5B, 0x90, 0xFA, 0x90, 0xEA, 0x7B, 0x26, 0x0B, 0x17, 0xF2, 0xE4, 0x03, 0xC7, 0xDC, 0x89, 0xC9, 
-  0xCC, 0x44, 0x4A, 0x58, 0x21, 0xD4, 0x7A, 0x0E, 0xE7, 0x76, 0xAE, 0xCC, 0x54, 0x5C, 0x38, 0xE6, 
-  0x99, 0x23, 0x0F, 0xFA, 0x8A, 0x03, 0x79, 0x42, 0xE8, 0xAE, 0x10, 0x26, 0x0D, 0xE4, 0xA1, 0x9F, 
-  0x67, 0x2C, 0x62, 0x1B, 0x9E, 0xA8, 0xD2, 0xD7, 0x17, 0xF4, 0x4C, 0x79, 0xFE, 0xF6, 0x7D, 0xBE, 
-  0x63, 0xF1, 0x70, 0x04, 0xBB, 0x78, 0x10, 0xB4, 0x3D, 0xB6, 0x80, 0x3E, 0x2B, 0xD2, 0x90, 0x59, 
-  0x39, 0x1C, 0xD8, 0x36, 0x2C, 0x1D, 0x30, 0xF3, 0x71, 0xC4, 0xCC, 0x65, 0xC4, 0x96, 0xDC, 0x8A, 
-  0x0F, 0x82, 0x76, 0x3C, 0xDC, 0x7A, 0xCC, 0x77, 0x2C, 0x77, 0x20, 0xD6, 0xCC, 0x1B, 0x42, 0x41, 
-  0x6E, 0x31, 0x6F, 0x27, 0xC7, 0x6F, 0xC0, 0x2C, 0xD8, 0x54, 0xAA, 0xB8, 0x39, 0x5B, 0xB6, 0x72, 
-  0xB6, 0x1E, 0x64, 0x61, 0x3C, 0xE0, 0x5E, 0xC8, 0x73, 0xCB, 0xCC, 0x06, 0x6C, 0x98, 0x79, 0xAB, 
-  0xCC, 0xB5, 0x40, 0xD0, 0x4C, 0x9C, 0x47, 0x36, 0x71, 0x96, 0x6C, 0x76, 0xD6, 0xF0, 0xAD, 0x82, 
-  0x82, 0x5B, 0x26, 0x83, 0xB6, 0x80, 0xFB, 0x1D, 0x58, 0xAA, 0x8B, 0x42, 0x93, 0xA9, 0xB9, 0xD4, 
-  0x4F, 0x02, 0xD9, 0x96, 0x91, 0x14, 0x5C, 0xF0, 0x14, 0xEE, 0x33, 0x87, 0x21, 0xF9, 0x4C, 0x90, 
-  0x6F, 0xA3, 0x3C, 0x67, 0x3B, 0xEE, 0xC6, 0xAA, 0x2C, 0x34, 0x5F, 0xA0, 0x92, 0x5B, 0xB2, 0xA7, 
-  0x2E, 0x62, 0x13, 0x0E, 0x1C, 0xFB, 0xB8, 0x0B, 0xD6, 0x55, 0x5D, 0x14, 0x3A, 0xFE, 0x2A, 0x95, 
-  0xD7, 0x21, 0xFB, 0x6A, 0xB3, 0xF1, 0x58, 0x9A, 0x41, 0x6C, 0xEE, 0x5A, 0x83, 0xE1, 0x0A, 0x4A, 
-  0x5F, 0x5D, 0x30, 0x61, 0x2B, 0x2E, 0xE6, 0x3B, 0xE6, 0xC7, 0x16, 0x74, 0x27, 0xB8, 0xBB, 0x85, 
-  0xE0, 0x5C, 0x4D, 0x0C, 0x80, 0x1F, 0xB3, 0xAD, 0x12, 0x1C, 0x72, 0x47, 0x1A, 0x99, 0x15, 0xC1, 
-  0x21, 0xF3, 0xA2, 0xB8, 0x14, 0x84, 0xDA, 0x09, 0x69, 0x52, 0x1E, 0x32, 0xD4, 0xB6, 0x3A, 0x67, 
-  0xB3, 0x38, 0x2C, 0xE2, 0x3E, 0x32, 0x5B, 0xA8, 0x34, 0xE8, 0x9B, 0x3B, 0x16, 0xCA, 0xD2, 0x09, 
-  0x1B, 0x45, 0xAE, 0x14, 0x9C, 0x41, 0x69, 0x33, 0x08, 0x82, 0x78, 0x74, 0x75, 0x41, 0xE1, 0x87, 
-  0x61, 0xC6, 0xD3, 0x98, 0xD9, 0x11, 0xD4, 0x73, 0x6E, 0xC6, 0xCF, 0x04, 0x61, 0x62, 0x1F, 0xC8, 
-  0x3A, 0x3A, 0x35, 0x41, 0xE8, 0x55, 0xD0, 0xFF, 0x94, 0xE0, 0x28, 0xE4, 0xD0, 0x34, 0x3B, 0x55, 
-  0x68, 0xC4, 0x32, 0xE8, 0x6D, 0xA3, 0x52, 0x50, 0x64, 0xEE, 0x50, 0xDE, 0x87, 0x99, 0xEC, 0x77, 
-  0x29, 0xC4, 0xDD, 0x0B, 0x0A, 0x18, 0xE2, 0x6E, 0x6E, 0xC5, 0x66, 0x57, 0x95, 0xCA, 0x99, 0xAD, 
-  0x04, 0x55, 0x43, 0x27, 0x9A, 0xE5, 0xE8, 0x9D, 0x82, 0x30, 0x55, 0x86, 0x0C, 0x86, 0x1A, 0x73, 
-  0x84, 0xCB, 0x5C, 0x66, 0x6E, 0xB9, 0xC7, 0xAC, 0x6C, 0x53, 0x08, 0x2E, 0x60, 0xDC, 0x9B, 0xD0, 
-  0x45, 0x37, 0x72, 0x92, 0x99, 0xF1, 0x39, 0x8C, 0x50, 0xD9, 0x45, 0x37, 0xCC, 0x0A, 0x5D, 0xB0, 
-  0x63, 0x66, 0x3C, 0x63, 0x41, 0x1C, 0xC2, 0xA5, 0x98, 0x85, 0x91, 0x6D, 0x41, 0x00, 0x2B, 0xE5, 
-  0xA1, 0x5A, 0x1A, 0xF8, 0x0A, 0xE6, 0x96, 0x50, 0x3E, 0xB6, 0x51, 0x71, 0x33, 0x39, 0x33, 0x0B, 
-  0xF8, 0x6C, 0x42, 0x77, 0x0C, 0x99, 0x1F, 0x41, 0x21, 0xB8, 0x8F, 0x71, 0x10, 0xB2, 0x45, 0xC6, 
-  0x60, 0xA8, 0xCE, 0x43, 0xD3, 0x0B, 0x43, 0xE7, 0xFA, 0x82, 0x30, 0xD0, 0x16, 0x9B, 0xB5, 0x9F, 
-  0xF8, 0xBC, 0x35, 0xC9, 0x97, 0x0E, 0x74, 0xD7, 0xCD, 0x26, 0x5D, 0x4D, 0xD4, 0xAD, 0x84, 0xA5, 
-  0x3A, 0x8A, 0xA0, 0x1D, 0x56, 0x13, 0x3F, 0x4D, 0xE6, 0xC2, 0x4F, 0x06, 0x5C, 0x4C, 0x60, 0x53, 
-  0x90, 0xE4, 0x0B, 0x9E, 0xAC, 0x60, 0xFD, 0x7F, 0x84, 0xBF, 0xA5, 0xFF, 0x08, 0xEE, 0x9B, 0x4D, 
-  0x06, 0x23, 0x76, 0x04, 0x61, 0xF8, 0xA2, 0x98, 0x29, 0xB8, 0x18, 0x46, 0xD1, 0x5A, 0xAE, 0x29, 
-  0x45, 0xDC, 0x2C, 0xE9, 0xB6, 0x78, 0x96, 0x47, 0x5B, 0xC1, 0x87, 0x30, 0x9E, 0x13, 0xB9, 0xCE, 
-  0x2E, 0x46, 0x93, 0xD6, 0x72, 0x65, 0x27, 0x5B, 0xD1, 0x2A, 0x4B, 0x9F, 0xF3, 0x7B, 0xEB, 0x56, 
-  0x4D, 0x0E, 0x16, 0x21, 0x97, 0xB7, 0x62, 0x2F, 0x25, 0x37, 0x58, 0xFB, 0x4D, 0x95, 0x28, 0x0E, 
-  0x9F, 0xF0, 0xB5, 0xC8, 0x20, 0x8A, 0x3D, 0x8B, 0x2A, 0xA0, 0x96, 0xB1, 0xFD, 0x47, 0x99, 0x71, 
-  0x1F, 0x60, 0xBF, 0x9A, 0x09, 0x7E, 0x08, 0x58, 0xFC, 0xD3, 0xDA, 0x6F, 0xD7, 0x54, 0xDE, 0x72, 
-  0x90, 0x8B, 0xE2, 0xC7, 0x0F, 0xD9, 0xFE, 0x05, 0x41, 0x3C, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 
-  0x24, 0x88, 0x1D, 0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x43, 0x82, 0xD8, 0x21, 0x41, 
-  0xEC, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 
-  0x04, 0xB1, 0x43, 0x82, 0xD8, 0x21, 0x41, 0xEC, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 
-  0x1D, 0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x43, 0x82, 0xD8, 0x21, 0x41, 0xEC, 0x90, 
-  0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 
-  0x43, 0x82, 0xD8, 0x21, 0x41, 0xEC, 0x90, 0x20, 0x76, 0x48, 0x10, 0x3B, 0x24, 0x88, 0x1D, 0x12, 
-  0xC4, 0x0E, 0x09, 0x62, 0x87, 0x04, 0xB1, 0x73, 0x46, 0x50, 0xF3, 0x9F, 0x0E, 0x20, 0xA4, 0x77, 
-  0xD3, 0x6E, 0x10, 0xEC, 0x7E, 0xFD, 0x1C, 0x3C, 0xB4, 0x7B, 0x5A, 0xC1, 0xC6, 0xB7, 0xDD, 0xA2, 
-  0x63, 0xAC, 0x13, 0x6C, 0xD5, 0xDF, 0x28, 0x8D, 0x19, 0xFD, 0x2B, 0xC0, 0x3F, 0x7A, 0xEC, 0x5C, 
-  0x91, 0xCB, 0x66, 0x25, 0x82, 0x20, 0x08, 0x82, 0x20, 0x70, 0xF2, 0x7F, 0xC5, 0xE1, 0x2A, 0xA3, 
-  0x93, 0x88, 0xE4, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 
+const uint16_t gspro_logo_palette[55] PROGMEM = {
+  0x0000, 0x0800, 0x0841, 0x1020, 0x1060, 0x1061, 0x1082, 0x10A3, 0x10C4, 0x10E5, 0x1126, 0x1127, 
+  0x1147, 0x1168, 0x11AA, 0x120C, 0x126E, 0x128F, 0x12B0, 0x1312, 0x18C3, 0x1B54, 0x1B96, 0x1BB6, 
+  0x1BF8, 0x1C19, 0x1C39, 0x2104, 0x2945, 0x3186, 0x39C7, 0x4208, 0x4A69, 0x528A, 0x5ACB, 0x5AEB, 
+  0x632C, 0x6B6D, 0x7BCF, 0x7BEF, 0x8410, 0x8C71, 0x9492, 0x94B2, 0xA514, 0xAD55, 0xB596, 0xBDF7, 
+  0xCE79, 0xD69A, 0xDEDB, 0xE73C, 0xF79E, 0xF7BE, 0xFFFF, 
+};
 
+const uint8_t gspro_logo_rle[6578] PROGMEM = {
+  0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 
+  0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 
+  0xFF, 0x06, 0xCB, 0x06, 0xFF, 0x05, 0xCA, 0x05, 0xFF, 0x06, 0xDF, 0x06, 0x00, 0x05, 0x91, 0x06, 
+  0x01, 0x03, 0x10, 0xFF, 0x18, 0xCA, 0x18, 0x01, 0x04, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x07, 0xFF, 0x09, 0xC6, 0x09, 0x03, 0x0B, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x05, 0xC5, 0x05, 0x04, 0x03, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0x95, 0x06, 0x01, 0x05, 0x05, 0xFF, 0x06, 0xAD, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x91, 0x06, 0x03, 0x05, 0x03, 0x01, 0x01, 0x95, 0x03, 
+  0x01, 0x04, 0x05, 0x84, 0x06, 0x02, 0x03, 0x01, 0x01, 0x94, 0x03, 0x00, 0x04, 0x83, 0x06, 0x00, 
+  0x02, 0x9A, 0x00, 0x00, 0x02, 0x83, 0x06, 0x00, 0x02, 0x9B, 0x00, 0x86, 0x06, 0x00, 0x02, 0x99, 
+  0x00, 0x00, 0x02, 0x94, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0x90, 0x06, 0x04, 0x05, 0x05, 0x10, 0x15, 0x16, 0x95, 0x18, 0x01, 0x15, 0x01, 0x82, 
+  0x06, 0x04, 0x05, 0x03, 0x0F, 0x13, 0x16, 0x94, 0x18, 0x05, 0x13, 0x01, 0x06, 0x06, 0x00, 0x20, 
+  0x97, 0x35, 0x09, 0x33, 0x31, 0x2C, 0x1D, 0x00, 0x06, 0x06, 0x02, 0x1B, 0x34, 0x96, 0x35, 0x05, 
+  0x34, 0x32, 0x2F, 0x25, 0x00, 0x02, 0x83, 0x06, 0x04, 0x02, 0x00, 0x28, 0x30, 0x33, 0x93, 0x35, 
+  0x04, 0x33, 0x30, 0x29, 0x06, 0x02, 0x93, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x03, 0x05, 0x07, 0x16, 0x1A, 0x97, 0x19, 0x01, 0x15, 
+  0x01, 0x82, 0x06, 0x02, 0x03, 0x13, 0x1A, 0x95, 0x19, 0x06, 0x1A, 0x13, 0x01, 0x06, 0x06, 0x00, 
+  0x20, 0x9B, 0x36, 0x04, 0x1F, 0x00, 0x06, 0x02, 0x1B, 0x9B, 0x36, 0x01, 0x2E, 0x00, 0x82, 0x06, 
+  0x02, 0x02, 0x02, 0x32, 0x99, 0x36, 0x02, 0x33, 0x02, 0x02, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x02, 0x03, 0x10, 0x1A, 0x84, 
+  0x19, 0x93, 0x1A, 0x06, 0x15, 0x01, 0x06, 0x06, 0x05, 0x09, 0x1A, 0x97, 0x19, 0x05, 0x13, 0x01, 
+  0x06, 0x06, 0x00, 0x20, 0x9B, 0x36, 0x04, 0x30, 0x00, 0x06, 0x02, 0x1B, 0x9C, 0x36, 0x05, 0x22, 
+  0x00, 0x06, 0x06, 0x00, 0x27, 0x9B, 0x36, 0x01, 0x2A, 0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x02, 0x01, 0x13, 0x1A, 0x83, 
+  0x19, 0x01, 0x15, 0x0E, 0x92, 0x0D, 0x06, 0x0C, 0x05, 0x06, 0x06, 0x03, 0x0E, 0x1A, 0x83, 0x19, 
+  0x02, 0x13, 0x07, 0x05, 0x94, 0x06, 0x01, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x00, 0x8D, 0x1B, 
+  0x01, 0x1D, 0x2B, 0x84, 0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 0x1B, 0x84, 0x36, 0x01, 0x35, 0x06, 
+  0x8E, 0x1B, 0x01, 0x24, 0x34, 0x84, 0x36, 0x05, 0x28, 0x00, 0x06, 0x06, 0x00, 0x2D, 0x84, 0x36, 
+  0x01, 0x2F, 0x1D, 0x8D, 0x06, 0x01, 0x1C, 0x2E, 0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x01, 0x01, 
+  0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x01, 0x93, 0x04, 0x82, 0x06, 0x02, 0x03, 0x0F, 0x1A, 0x82, 
+  0x19, 0x02, 0x1A, 0x0F, 0x03, 0x92, 0x05, 0x82, 0x06, 0x01, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 
+  0x00, 0x8D, 0x02, 0x02, 0x00, 0x14, 0x35, 0x83, 0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 0x1B, 0x84, 
+  0x36, 0x01, 0x35, 0x00, 0x8E, 0x02, 0x01, 0x00, 0x2F, 0x84, 0x36, 0x05, 0x28, 0x00, 0x06, 0x06, 
+  0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x02, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 
+  0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x96, 0x06, 0x02, 0x03, 0x0F, 
+  0x1A, 0x82, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x95, 0x06, 0x01, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 
+  0x00, 0x8D, 0x06, 0x02, 0x02, 0x1B, 0x35, 0x83, 0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 0x1B, 0x84, 
+  0x36, 0x01, 0x35, 0x00, 0x8E, 0x06, 0x01, 0x00, 0x2F, 0x84, 0x36, 0x05, 0x28, 0x00, 0x06, 0x06, 
+  0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 
+  0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x96, 0x06, 0x02, 0x03, 0x0F, 
+  0x1A, 0x82, 0x19, 0x02, 0x1A, 0x0F, 0x01, 0x90, 0x05, 0x84, 0x06, 0x01, 0x00, 0x20, 0x84, 0x36, 
+  0x01, 0x32, 0x00, 0x8D, 0x06, 0x02, 0x02, 0x1B, 0x35, 0x83, 0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 
+  0x1B, 0x84, 0x36, 0x01, 0x35, 0x00, 0x8E, 0x06, 0x01, 0x00, 0x2F, 0x84, 0x36, 0x05, 0x28, 0x00, 
+  0x06, 0x06, 0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 
+  0x01, 0x2F, 0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x8D, 0x06, 0x01, 
+  0x05, 0x03, 0x83, 0x01, 0x05, 0x05, 0x06, 0x06, 0x03, 0x0F, 0x1A, 0x83, 0x19, 0x00, 0x15, 0x8F, 
+  0x0C, 0x03, 0x09, 0x05, 0x03, 0x05, 0x82, 0x06, 0x01, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x00, 
+  0x8D, 0x06, 0x02, 0x02, 0x1B, 0x35, 0x83, 0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 0x1B, 0x84, 0x36, 
+  0x02, 0x35, 0x00, 0x02, 0x8D, 0x06, 0x01, 0x00, 0x2F, 0x84, 0x36, 0x05, 0x28, 0x00, 0x06, 0x06, 
+  0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 
+  0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x8C, 0x06, 0x01, 0x04, 0x0D, 
+  0x84, 0x15, 0x05, 0x08, 0x05, 0x06, 0x04, 0x0B, 0x1A, 0x95, 0x19, 0x07, 0x17, 0x11, 0x04, 0x05, 
+  0x06, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x00, 0x8D, 0x06, 0x02, 0x02, 0x1B, 0x35, 0x83, 
+  0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 0x1B, 0x84, 0x36, 0x00, 0x35, 0x90, 0x00, 0x00, 0x32, 0x84, 
+  0x36, 0x05, 0x25, 0x00, 0x06, 0x06, 0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 
+  0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 
+  0x03, 0x8C, 0x06, 0x02, 0x04, 0x0E, 0x1A, 0x82, 0x19, 0x08, 0x1A, 0x08, 0x05, 0x06, 0x06, 0x03, 
+  0x13, 0x1A, 0x1A, 0x94, 0x19, 0x06, 0x1A, 0x13, 0x01, 0x06, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 
+  0x32, 0x00, 0x8D, 0x02, 0x02, 0x00, 0x14, 0x35, 0x83, 0x36, 0x04, 0x33, 0x00, 0x02, 0x02, 0x1B, 
+  0x84, 0x36, 0x01, 0x35, 0x20, 0x8E, 0x33, 0x00, 0x35, 0x84, 0x36, 0x06, 0x2F, 0x00, 0x02, 0x06, 
+  0x06, 0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 
+  0x2F, 0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x8C, 0x06, 0x02, 0x03, 
+  0x0E, 0x1A, 0x82, 0x19, 0x08, 0x1A, 0x08, 0x05, 0x06, 0x06, 0x05, 0x03, 0x0E, 0x12, 0x8F, 0x15, 
+  0x00, 0x16, 0x84, 0x19, 0x05, 0x18, 0x03, 0x05, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x00, 
+  0x8D, 0x1D, 0x01, 0x1E, 0x2C, 0x84, 0x36, 0x04, 0x33, 0x00, 0x06, 0x02, 0x1B, 0x84, 0x36, 0x01, 
+  0x34, 0x22, 0x93, 0x36, 0x02, 0x34, 0x24, 0x00, 0x82, 0x06, 0x01, 0x00, 0x2E, 0x84, 0x36, 0x01, 
+  0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x01, 0x01, 0x13, 
+  0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x8C, 0x06, 0x02, 0x03, 0x0E, 0x1A, 0x82, 0x19, 0x02, 0x1A, 
+  0x08, 0x05, 0x83, 0x06, 0x00, 0x04, 0x90, 0x01, 0x01, 0x03, 0x16, 0x83, 0x19, 0x05, 0x18, 0x04, 
+  0x05, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x26, 0x94, 0x36, 0x04, 0x30, 0x00, 0x06, 0x02, 
+  0x1B, 0x84, 0x36, 0x02, 0x34, 0x21, 0x36, 0x8D, 0x35, 0x86, 0x36, 0x05, 0x2E, 0x00, 0x06, 0x06, 
+  0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 
+  0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x8C, 0x06, 0x02, 0x03, 0x0E, 
+  0x1A, 0x82, 0x19, 0x02, 0x1A, 0x08, 0x05, 0x95, 0x06, 0x01, 0x01, 0x15, 0x83, 0x19, 0x05, 0x18, 
+  0x04, 0x05, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x31, 0x26, 0x93, 0x36, 0x05, 0x35, 0x1F, 0x00, 
+  0x06, 0x02, 0x1B, 0x84, 0x36, 0x01, 0x35, 0x00, 0x8E, 0x02, 0x01, 0x14, 0x2A, 0x84, 0x36, 0x05, 
+  0x35, 0x00, 0x06, 0x06, 0x00, 0x2E, 0x84, 0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 
+  0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x01, 0x01, 0x13, 0x83, 0x19, 0x02, 0x1A, 0x0F, 0x03, 0x8C, 
+  0x06, 0x02, 0x04, 0x0E, 0x1A, 0x82, 0x19, 0x02, 0x1A, 0x08, 0x05, 0x95, 0x06, 0x01, 0x01, 0x15, 
+  0x83, 0x19, 0x05, 0x18, 0x04, 0x05, 0x06, 0x00, 0x20, 0x84, 0x36, 0x02, 0x32, 0x25, 0x36, 0x8E, 
+  0x35, 0x09, 0x34, 0x33, 0x31, 0x2C, 0x1D, 0x00, 0x06, 0x06, 0x02, 0x1B, 0x84, 0x36, 0x01, 0x35, 
+  0x00, 0x8E, 0x02, 0x01, 0x00, 0x1D, 0x84, 0x36, 0x05, 0x35, 0x00, 0x06, 0x06, 0x00, 0x2E, 0x84, 
+  0x36, 0x01, 0x23, 0x00, 0x8D, 0x06, 0x01, 0x00, 0x24, 0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x01, 
+  0x01, 0x13, 0x83, 0x19, 0x03, 0x1A, 0x0F, 0x01, 0x05, 0x88, 0x04, 0x05, 0x05, 0x04, 0x05, 0x03, 
+  0x0E, 0x1A, 0x82, 0x19, 0x06, 0x1A, 0x08, 0x05, 0x06, 0x06, 0x05, 0x05, 0x8E, 0x04, 0x04, 0x05, 
+  0x04, 0x03, 0x01, 0x15, 0x83, 0x19, 0x05, 0x18, 0x04, 0x05, 0x06, 0x00, 0x20, 0x84, 0x36, 0x00, 
+  0x32, 0x94, 0x00, 0x00, 0x02, 0x82, 0x06, 0x01, 0x02, 0x1B, 0x84, 0x36, 0x01, 0x35, 0x00, 0x8E, 
+  0x06, 0x01, 0x02, 0x1E, 0x84, 0x36, 0x05, 0x35, 0x00, 0x06, 0x06, 0x00, 0x2E, 0x84, 0x36, 0x00, 
+  0x23, 0x8F, 0x00, 0x00, 0x23, 0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x01, 0x01, 0x13, 0x84, 0x19, 
+  0x01, 0x15, 0x0D, 0x8A, 0x0B, 0x03, 0x0C, 0x0C, 0x0A, 0x0F, 0x83, 0x19, 0x05, 0x1A, 0x08, 0x05, 
+  0x06, 0x05, 0x08, 0x90, 0x0B, 0x03, 0x0C, 0x0C, 0x0F, 0x18, 0x83, 0x19, 0x05, 0x18, 0x03, 0x05, 
+  0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x00, 0x97, 0x06, 0x01, 0x02, 0x1B, 0x84, 0x36, 0x01, 
+  0x35, 0x00, 0x8E, 0x06, 0x01, 0x02, 0x1E, 0x84, 0x36, 0x05, 0x35, 0x00, 0x06, 0x06, 0x00, 0x2D, 
+  0x84, 0x36, 0x01, 0x31, 0x24, 0x8D, 0x23, 0x01, 0x25, 0x30, 0x84, 0x36, 0x01, 0x2F, 0x00, 0x92, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 
+  0x02, 0x03, 0x0F, 0x1A, 0x84, 0x19, 0x8E, 0x1A, 0x84, 0x19, 0x05, 0x1A, 0x08, 0x05, 0x06, 0x03, 
+  0x0F, 0x93, 0x1A, 0x84, 0x19, 0x05, 0x16, 0x01, 0x06, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 
+  0x00, 0x97, 0x06, 0x01, 0x02, 0x1B, 0x84, 0x36, 0x01, 0x35, 0x00, 0x8E, 0x06, 0x01, 0x02, 0x1E, 
+  0x84, 0x36, 0x05, 0x35, 0x00, 0x06, 0x06, 0x00, 0x25, 0x9B, 0x36, 0x01, 0x29, 0x00, 0x92, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x8F, 0x06, 0x03, 
+  0x05, 0x05, 0x15, 0x1A, 0x97, 0x19, 0x06, 0x1A, 0x08, 0x05, 0x06, 0x03, 0x0F, 0x1A, 0x95, 0x19, 
+  0x07, 0x1A, 0x18, 0x0D, 0x04, 0x06, 0x06, 0x00, 0x20, 0x84, 0x36, 0x01, 0x32, 0x00, 0x97, 0x06, 
+  0x01, 0x02, 0x1C, 0x84, 0x36, 0x01, 0x35, 0x00, 0x8E, 0x06, 0x01, 0x02, 0x1E, 0x84, 0x36, 0x06, 
+  0x35, 0x00, 0x06, 0x06, 0x02, 0x00, 0x30, 0x99, 0x36, 0x02, 0x31, 0x00, 0x02, 0x92, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x90, 0x06, 0x04, 0x05, 
+  0x03, 0x0F, 0x13, 0x15, 0x96, 0x16, 0x05, 0x08, 0x05, 0x06, 0x04, 0x0E, 0x17, 0x94, 0x16, 0x03, 
+  0x13, 0x10, 0x07, 0x03, 0x82, 0x06, 0x01, 0x00, 0x20, 0x84, 0x33, 0x01, 0x2F, 0x00, 0x97, 0x06, 
+  0x01, 0x02, 0x1B, 0x84, 0x33, 0x01, 0x32, 0x00, 0x8E, 0x06, 0x01, 0x02, 0x1D, 0x84, 0x33, 0x01, 
+  0x32, 0x00, 0x82, 0x06, 0x04, 0x02, 0x00, 0x24, 0x2E, 0x31, 0x93, 0x33, 0x04, 0x31, 0x2F, 0x25, 
+  0x00, 0x02, 0x93, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0x91, 0x06, 0x01, 0x05, 0x03, 0x82, 0x01, 0x95, 0x03, 0x00, 0x05, 0x82, 0x06, 0x00, 0x04, 
+  0x93, 0x03, 0x82, 0x01, 0x01, 0x03, 0x05, 0x84, 0x06, 0x00, 0x02, 0x85, 0x00, 0x99, 0x06, 0x00, 
+  0x02, 0x85, 0x00, 0x90, 0x06, 0x00, 0x02, 0x85, 0x00, 0x85, 0x06, 0x99, 0x00, 0x95, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0x9C, 0x06, 0x82, 0x00, 0x8A, 0x06, 0x01, 0x00, 0x00, 0x82, 0x06, 0x82, 0x00, 0x00, 0x02, 
+  0x83, 0x06, 0x08, 0x02, 0x00, 0x00, 0x02, 0x06, 0x06, 0x00, 0x00, 0x02, 0x92, 0x06, 0x02, 0x02, 
+  0x00, 0x00, 0x9D, 0x06, 0x03, 0x02, 0x00, 0x00, 0x02, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x02, 0xBD, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x9A, 0x06, 
+  0x06, 0x00, 0x00, 0x21, 0x27, 0x22, 0x00, 0x00, 0x87, 0x06, 0x17, 0x00, 0x2A, 0x29, 0x00, 0x06, 
+  0x00, 0x25, 0x30, 0x2E, 0x1C, 0x02, 0x06, 0x06, 0x00, 0x1D, 0x26, 0x25, 0x1B, 0x00, 0x00, 0x24, 
+  0x2D, 0x1B, 0x02, 0x90, 0x06, 0x04, 0x02, 0x14, 0x2E, 0x22, 0x00, 0x87, 0x06, 0x01, 0x00, 0x00, 
+  0x91, 0x06, 0x05, 0x00, 0x14, 0x25, 0x26, 0x1D, 0x00, 0x88, 0x06, 0x06, 0x00, 0x25, 0x30, 0x2E, 
+  0x1B, 0x00, 0x00, 0xBB, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0x99, 0x06, 0x02, 0x00, 0x1E, 0x33, 0x82, 0x36, 0x02, 0x34, 0x20, 0x00, 0x82, 0x06, 
+  0x00, 0x02, 0x82, 0x06, 0x0D, 0x00, 0x32, 0x31, 0x00, 0x00, 0x20, 0x36, 0x32, 0x2F, 0x1D, 0x02, 
+  0x06, 0x00, 0x2D, 0x83, 0x36, 0x09, 0x2D, 0x00, 0x2B, 0x35, 0x1D, 0x02, 0x02, 0x06, 0x06, 0x02, 
+  0x82, 0x06, 0x00, 0x02, 0x87, 0x06, 0x05, 0x02, 0x02, 0x1B, 0x36, 0x28, 0x00, 0x82, 0x06, 0x00, 
+  0x02, 0x82, 0x06, 0x03, 0x00, 0x33, 0x32, 0x00, 0x83, 0x06, 0x00, 0x02, 0x86, 0x06, 0x00, 0x02, 
+  0x82, 0x06, 0x01, 0x00, 0x29, 0x83, 0x36, 0x01, 0x30, 0x00, 0x82, 0x06, 0x00, 0x02, 0x82, 0x06, 
+  0x0D, 0x00, 0x20, 0x36, 0x32, 0x30, 0x14, 0x34, 0x30, 0x00, 0x06, 0x02, 0x06, 0x06, 0x02, 0x87, 
+  0x06, 0x01, 0x02, 0x02, 0x83, 0x06, 0x03, 0x02, 0x06, 0x02, 0x02, 0x82, 0x06, 0x00, 0x02, 0x9F, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x98, 0x06, 
+  0x26, 0x02, 0x02, 0x33, 0x35, 0x24, 0x1B, 0x22, 0x35, 0x31, 0x00, 0x06, 0x00, 0x00, 0x14, 0x00, 
+  0x00, 0x06, 0x00, 0x32, 0x31, 0x00, 0x00, 0x28, 0x36, 0x1B, 0x00, 0x02, 0x06, 0x00, 0x20, 0x36, 
+  0x2D, 0x1B, 0x1D, 0x2C, 0x29, 0x00, 0x14, 0x1D, 0x82, 0x02, 0x02, 0x00, 0x00, 0x06, 0x82, 0x00, 
+  0x4C, 0x06, 0x00, 0x02, 0x06, 0x02, 0x02, 0x06, 0x06, 0x02, 0x00, 0x00, 0x1B, 0x36, 0x28, 0x00, 
+  0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0x00, 0x32, 0x31, 0x00, 0x02, 0x06, 0x00, 0x00, 0x14, 
+  0x00, 0x00, 0x06, 0x06, 0x02, 0x00, 0x00, 0x1B, 0x02, 0x06, 0x02, 0x06, 0x36, 0x30, 0x1B, 0x1C, 
+  0x28, 0x2D, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x26, 0x36, 0x06, 0x00, 0x00, 
+  0x33, 0x2F, 0x00, 0x06, 0x02, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x02, 0x00, 0x06, 0x82, 0x00, 
+  0x0E, 0x06, 0x00, 0x00, 0x06, 0x02, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 
+  0x9D, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x98, 
+  0x06, 0x15, 0x00, 0x28, 0x36, 0x23, 0x00, 0x02, 0x00, 0x1E, 0x1C, 0x02, 0x00, 0x26, 0x34, 0x36, 
+  0x35, 0x2C, 0x00, 0x00, 0x32, 0x31, 0x00, 0x25, 0x82, 0x36, 0x06, 0x2F, 0x00, 0x06, 0x00, 0x24, 
+  0x36, 0x28, 0x84, 0x00, 0x37, 0x2B, 0x36, 0x1D, 0x20, 0x36, 0x29, 0x35, 0x36, 0x31, 0x21, 0x33, 
+  0x36, 0x33, 0x1D, 0x00, 0x32, 0x2F, 0x00, 0x00, 0x28, 0x36, 0x1C, 0x14, 0x36, 0x28, 0x00, 0x14, 
+  0x2F, 0x35, 0x36, 0x34, 0x26, 0x00, 0x2E, 0x36, 0x36, 0x35, 0x1F, 0x00, 0x28, 0x35, 0x36, 0x35, 
+  0x29, 0x00, 0x00, 0x33, 0x2F, 0x33, 0x34, 0x00, 0x06, 0x02, 0x1D, 0x36, 0x2E, 0x83, 0x00, 0x2E, 
+  0x06, 0x00, 0x26, 0x34, 0x36, 0x35, 0x2C, 0x00, 0x24, 0x36, 0x36, 0x35, 0x2E, 0x2F, 0x36, 0x36, 
+  0x34, 0x1D, 0x35, 0x29, 0x00, 0x34, 0x25, 0x30, 0x2E, 0x00, 0x32, 0x2F, 0x1C, 0x31, 0x36, 0x36, 
+  0x34, 0x21, 0x00, 0x1F, 0x36, 0x2B, 0x36, 0x2C, 0x00, 0x29, 0x35, 0x36, 0x35, 0x29, 0x00, 0x9C, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x98, 0x06, 
+  0x7F, 0x00, 0x2F, 0x35, 0x00, 0x06, 0x02, 0x1B, 0x14, 0x14, 0x00, 0x22, 0x36, 0x30, 0x23, 0x2E, 
+  0x36, 0x29, 0x00, 0x32, 0x31, 0x00, 0x1B, 0x2F, 0x36, 0x26, 0x20, 0x00, 0x06, 0x02, 0x1C, 0x34, 
+  0x36, 0x33, 0x2D, 0x23, 0x00, 0x00, 0x2C, 0x36, 0x1C, 0x20, 0x36, 0x35, 0x27, 0x2E, 0x36, 0x35, 
+  0x2A, 0x2B, 0x36, 0x2A, 0x00, 0x33, 0x30, 0x00, 0x00, 0x28, 0x36, 0x1C, 0x14, 0x36, 0x28, 0x00, 
+  0x1B, 0x30, 0x23, 0x1E, 0x2F, 0x36, 0x14, 0x1D, 0x33, 0x32, 0x20, 0x02, 0x25, 0x36, 0x2F, 0x23, 
+  0x2F, 0x36, 0x26, 0x00, 0x33, 0x36, 0x2F, 0x22, 0x02, 0x06, 0x06, 0x00, 0x31, 0x36, 0x33, 0x2F, 
+  0x25, 0x00, 0x00, 0x22, 0x36, 0x30, 0x23, 0x2D, 0x36, 0x2A, 0x06, 0x2D, 0x36, 0x25, 0x20, 0x1F, 
+  0x34, 0x30, 0x20, 0x00, 0x2F, 0x34, 0x00, 0x2D, 0x33, 0x35, 0x1F, 0x20, 0x36, 0x23, 0x1F, 0x2F, 
+  0x21, 0x10, 0x1F, 0x32, 0x33, 0x00, 0x1F, 0x36, 0x35, 0x29, 0x1D, 0x27, 0x36, 0x28, 0x1D, 0x2A, 
+  0x36, 0x24, 0x00, 0x9B, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0x98, 0x06, 0x0B, 0x00, 0x2F, 0x35, 0x00, 0x02, 0x00, 0x33, 0x35, 0x36, 0x14, 0x2F, 
+  0x35, 0x82, 0x00, 0x0A, 0x31, 0x33, 0x00, 0x32, 0x31, 0x00, 0x00, 0x2B, 0x36, 0x1D, 0x00, 0x82, 
+  0x06, 0x2F, 0x00, 0x14, 0x29, 0x31, 0x36, 0x36, 0x2F, 0x00, 0x2B, 0x36, 0x1C, 0x20, 0x36, 0x26, 
+  0x00, 0x1C, 0x36, 0x2C, 0x00, 0x00, 0x36, 0x2D, 0x00, 0x33, 0x30, 0x00, 0x00, 0x28, 0x36, 0x1C, 
+  0x14, 0x36, 0x28, 0x00, 0x00, 0x1E, 0x2B, 0x2D, 0x2D, 0x36, 0x22, 0x00, 0x32, 0x30, 0x00, 0x00, 
+  0x31, 0x33, 0x82, 0x00, 0x06, 0x33, 0x31, 0x00, 0x33, 0x30, 0x00, 0x00, 0x82, 0x06, 0x09, 0x02, 
+  0x00, 0x26, 0x30, 0x35, 0x36, 0x32, 0x00, 0x2F, 0x35, 0x82, 0x00, 0x29, 0x31, 0x33, 0x00, 0x26, 
+  0x36, 0x06, 0x00, 0x00, 0x33, 0x2F, 0x00, 0x00, 0x20, 0x36, 0x21, 0x1C, 0x36, 0x32, 0x00, 0x2F, 
+  0x33, 0x00, 0x00, 0x21, 0x2C, 0x2C, 0x2F, 0x36, 0x1C, 0x1F, 0x36, 0x26, 0x00, 0x00, 0x32, 0x33, 
+  0x20, 0x23, 0x21, 0x33, 0x31, 0x00, 0x9B, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0x98, 0x06, 0x19, 0x00, 0x29, 0x36, 0x21, 0x00, 0x02, 0x1D, 0x22, 
+  0x36, 0x14, 0x30, 0x33, 0x00, 0x06, 0x00, 0x2F, 0x34, 0x00, 0x32, 0x31, 0x00, 0x00, 0x2B, 0x36, 
+  0x1D, 0x02, 0x82, 0x06, 0x83, 0x00, 0x34, 0x14, 0x30, 0x36, 0x1E, 0x2B, 0x36, 0x1C, 0x20, 0x36, 
+  0x23, 0x00, 0x1D, 0x36, 0x28, 0x00, 0x00, 0x35, 0x2D, 0x00, 0x33, 0x30, 0x00, 0x00, 0x28, 0x36, 
+  0x1C, 0x14, 0x36, 0x28, 0x00, 0x23, 0x36, 0x2F, 0x2B, 0x30, 0x36, 0x22, 0x00, 0x32, 0x30, 0x00, 
+  0x00, 0x33, 0x31, 0x00, 0x02, 0x00, 0x31, 0x33, 0x00, 0x33, 0x2F, 0x00, 0x83, 0x06, 0x00, 0x02, 
+  0x83, 0x00, 0x2B, 0x2D, 0x36, 0x24, 0x30, 0x34, 0x00, 0x06, 0x00, 0x2F, 0x34, 0x00, 0x27, 0x36, 
+  0x1B, 0x02, 0x00, 0x33, 0x2F, 0x00, 0x06, 0x00, 0x32, 0x2F, 0x22, 0x36, 0x34, 0x14, 0x36, 0x28, 
+  0x00, 0x29, 0x36, 0x2E, 0x2B, 0x32, 0x36, 0x1C, 0x1F, 0x36, 0x24, 0x00, 0x00, 0x33, 0x35, 0x82, 
+  0x31, 0x02, 0x30, 0x2E, 0x00, 0x9B, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0x98, 0x06, 0x55, 0x02, 0x14, 0x34, 0x34, 0x1F, 0x00, 0x1C, 0x30, 0x36, 
+  0x1B, 0x2B, 0x36, 0x22, 0x00, 0x1D, 0x35, 0x30, 0x00, 0x32, 0x31, 0x00, 0x00, 0x2B, 0x36, 0x1D, 
+  0x02, 0x06, 0x06, 0x00, 0x25, 0x30, 0x20, 0x00, 0x00, 0x2D, 0x36, 0x1D, 0x2B, 0x36, 0x1C, 0x20, 
+  0x36, 0x23, 0x00, 0x1D, 0x36, 0x28, 0x00, 0x00, 0x35, 0x2D, 0x00, 0x32, 0x33, 0x00, 0x00, 0x31, 
+  0x36, 0x1C, 0x14, 0x36, 0x28, 0x00, 0x2E, 0x34, 0x00, 0x00, 0x26, 0x36, 0x22, 0x00, 0x32, 0x31, 
+  0x00, 0x00, 0x2E, 0x36, 0x1F, 0x00, 0x1F, 0x36, 0x2E, 0x00, 0x33, 0x2F, 0x00, 0x82, 0x06, 0x31, 
+  0x02, 0x1F, 0x32, 0x23, 0x00, 0x00, 0x28, 0x36, 0x24, 0x2A, 0x36, 0x24, 0x00, 0x1C, 0x35, 0x30, 
+  0x00, 0x27, 0x36, 0x1B, 0x02, 0x00, 0x33, 0x2F, 0x00, 0x02, 0x00, 0x25, 0x36, 0x32, 0x2D, 0x33, 
+  0x30, 0x35, 0x06, 0x00, 0x32, 0x31, 0x00, 0x00, 0x2D, 0x36, 0x1B, 0x1F, 0x36, 0x24, 0x00, 0x00, 
+  0x2F, 0x35, 0x82, 0x00, 0x02, 0x29, 0x1B, 0x02, 0x9B, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x99, 0x06, 0x54, 0x00, 0x20, 0x34, 0x36, 0x34, 0x36, 
+  0x33, 0x36, 0x1D, 0x02, 0x32, 0x36, 0x32, 0x36, 0x35, 0x1E, 0x00, 0x2F, 0x36, 0x33, 0x1F, 0x2C, 
+  0x36, 0x1D, 0x02, 0x06, 0x06, 0x00, 0x26, 0x35, 0x36, 0x35, 0x35, 0x36, 0x2F, 0x00, 0x2C, 0x36, 
+  0x1D, 0x20, 0x36, 0x24, 0x00, 0x1D, 0x36, 0x29, 0x00, 0x00, 0x36, 0x2D, 0x00, 0x2C, 0x36, 0x33, 
+  0x34, 0x32, 0x36, 0x28, 0x00, 0x36, 0x35, 0x30, 0x24, 0x36, 0x31, 0x30, 0x34, 0x36, 0x2D, 0x00, 
+  0x30, 0x36, 0x34, 0x2B, 0x1B, 0x33, 0x36, 0x32, 0x36, 0x33, 0x1C, 0x00, 0x34, 0x30, 0x00, 0x82, 
+  0x06, 0x37, 0x00, 0x21, 0x34, 0x36, 0x35, 0x34, 0x36, 0x32, 0x00, 0x00, 0x32, 0x36, 0x32, 0x36, 
+  0x35, 0x1F, 0x00, 0x28, 0x36, 0x1B, 0x02, 0x00, 0x32, 0x36, 0x35, 0x26, 0x00, 0x00, 0x34, 0x36, 
+  0x14, 0x2B, 0x36, 0x2D, 0x00, 0x00, 0x2B, 0x36, 0x30, 0x31, 0x34, 0x36, 0x26, 0x1F, 0x36, 0x25, 
+  0x00, 0x00, 0x1D, 0x34, 0x35, 0x2F, 0x34, 0x34, 0x1D, 0x02, 0x9B, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x9A, 0x06, 0x17, 0x00, 0x14, 0x26, 0x2C, 
+  0x25, 0x14, 0x29, 0x14, 0x00, 0x06, 0x28, 0x2D, 0x2A, 0x1D, 0x00, 0x02, 0x1D, 0x2C, 0x2C, 0x1C, 
+  0x21, 0x28, 0x1B, 0x02, 0x82, 0x06, 0x38, 0x00, 0x14, 0x25, 0x2B, 0x2B, 0x23, 0x00, 0x00, 0x21, 
+  0x28, 0x14, 0x1C, 0x29, 0x1D, 0x02, 0x14, 0x29, 0x20, 0x00, 0x02, 0x28, 0x22, 0x00, 0x00, 0x29, 
+  0x2D, 0x26, 0x00, 0x29, 0x21, 0x00, 0x24, 0x2D, 0x27, 0x00, 0x24, 0x2D, 0x2A, 0x14, 0x27, 0x24, 
+  0x00, 0x1D, 0x2C, 0x2C, 0x1F, 0x00, 0x14, 0x29, 0x2E, 0x29, 0x14, 0x00, 0x00, 0x26, 0x24, 0x00, 
+  0x83, 0x06, 0x35, 0x00, 0x02, 0x23, 0x2B, 0x2B, 0x25, 0x06, 0x02, 0x02, 0x06, 0x28, 0x2D, 0x2A, 
+  0x1D, 0x00, 0x02, 0x1F, 0x29, 0x06, 0x06, 0x00, 0x1F, 0x2D, 0x2B, 0x1E, 0x02, 0x00, 0x23, 0x26, 
+  0x00, 0x1C, 0x29, 0x1D, 0x02, 0x06, 0x00, 0x26, 0x2E, 0x28, 0x06, 0x2A, 0x21, 0x1B, 0x29, 0x1E, 
+  0x02, 0x06, 0x00, 0x14, 0x29, 0x2E, 0x29, 0x14, 0x00, 0x9C, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0x9B, 0x06, 0x00, 0x02, 0x82, 0x00, 0x04, 0x02, 
+  0x00, 0x02, 0x06, 0x02, 0x82, 0x00, 0x09, 0x02, 0x06, 0x06, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x02, 0x84, 0x06, 0x00, 0x02, 0x83, 0x00, 0x11, 0x06, 0x06, 0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 
+  0x06, 0x02, 0x00, 0x02, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06, 0x82, 0x00, 0x03, 0x02, 0x00, 0x00, 
+  0x06, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x04, 0x02, 0x00, 0x00, 0x06, 0x02, 0x82, 0x00, 0x01, 
+  0x06, 0x02, 0x82, 0x00, 0x04, 0x02, 0x06, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 0x02, 0x83, 0x00, 
+  0x03, 0x02, 0x06, 0x06, 0x02, 0x82, 0x00, 0x04, 0x02, 0x06, 0x06, 0x02, 0x00, 0x82, 0x06, 0x82, 
+  0x00, 0x08, 0x02, 0x06, 0x06, 0x00, 0x00, 0x06, 0x02, 0x00, 0x02, 0x82, 0x06, 0x82, 0x00, 0x05, 
+  0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x82, 0x06, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x9D, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 
+  0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 
+  0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 
+  0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 
+  0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 
+  0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 
+  0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 
+  0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 
+  0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 
+  0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 
+  0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 
+  0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 0x90, 
+  0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 0x05, 
+  0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 0x05, 
+  0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 0x19, 
+  0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x06, 0xC5, 0x06, 0x04, 0x05, 0x09, 
+  0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x01, 0xFF, 0x05, 0xC5, 0x05, 0x04, 0x04, 
+  0x09, 0x19, 0x05, 0x05, 0x90, 0x06, 0x03, 0x01, 0x12, 0x13, 0x06, 0xFF, 0x08, 0xC6, 0x08, 0x03, 
+  0x0C, 0x19, 0x04, 0x05, 0x90, 0x06, 0x02, 0x01, 0x12, 0x1A, 0xFF, 0x19, 0xC8, 0x19, 0x02, 0x1A, 
+  0x04, 0x05, 0x91, 0x06, 0x00, 0x05, 0xFF, 0x04, 0xCA, 0x04, 0x00, 0x05, 0x93, 0x06, 0xFF, 0x05, 
+  0xCA, 0x05, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 
+  0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 
+  0xE8, 0x06, 
 };
 
-const uint32_t gspro_logo_len = 2224;
+const RleImage gspro_logo = { 224, 224, 55, gspro_logo_palette, gspro_logo_rle, 6578 };
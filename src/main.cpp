@@ -4,6 +4,20 @@
 #include "BleCombo.h"  // Now uses WiFi UDP
 #include <Wire.h>
 #include "Touch.h"
+#include "Gesture.h"
+#include "GestureCommands.h"
+#include "ImageStream.h"
+#include "EventLoop.h"
+#include "PowerManager.h"
+#include "Fonts.h"
+#include "logo_image.h"
+#include "config.h"
+#ifdef SEND_BENCHMARK
+#include "SendBenchmark.h"
+#endif
+#ifdef ALLOC_CHECK
+#include "AllocCheck.h"
+#endif
 #include "esp_system.h"
 #include <WiFi.h> 
 
@@ -17,6 +31,9 @@ static lv_color_t buf[screenWidth * 5]; // Reduced buffer to save RAM
 TFT_eSPI tft = TFT_eSPI();
 BleComboWrapper bleCombo("GSPRO Controller");
 Touch touch;
+EventLoop eventLoop;
+PowerManager power;
+static lv_indev_t *g_indev = NULL;
 
 // Forward Declaration
 void load_main_ui();
@@ -27,6 +44,41 @@ void touchpad_btn_event_handler(lv_event_t *e);
 static lv_obj_t * volatile g_status_label = NULL;
 static lv_timer_t * g_status_timer = NULL; // Global timer handle
 
+/* Status text: the label only ever points at literals or these fixed buffers
+   (lv_label_set_text_static), so updating it never touches the heap */
+static char g_status_msg[48];       // Formatted messages ("Sent: F5", RTT)
+static char g_status_conn[32];      // "UDP: 192.168.1.20", rebuilt only when transport or IP changes
+static const char *g_status_shown = NULL;
+
+void set_status(const char *text) {
+    if (!g_status_label) return;
+    g_status_shown = text;
+    lv_label_set_text_static(g_status_label, text);
+}
+
+void set_status_fmt(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(g_status_msg, sizeof(g_status_msg), fmt, args);
+    va_end(args);
+    set_status(g_status_msg);
+}
+
+// Returns true when the text changed; replaces WiFi.localIP().toString(), which built a String every second
+bool format_connection_status() {
+    static uint32_t shown_ip = 0;
+    static const char *shown_name = NULL;
+
+    IPAddress ip = WiFi.localIP();
+    const char *name = bleCombo.transport().name();
+    if ((uint32_t)ip == shown_ip && name == shown_name) return false;
+
+    shown_ip = (uint32_t)ip;
+    shown_name = name;
+    snprintf(g_status_conn, sizeof(g_status_conn), "%s: %u.%u.%u.%u", name, ip[0], ip[1], ip[2], ip[3]);
+    return true;
+}
+
 /* Key Mapping Struct */
 struct KeyMap {
     const char *label;
@@ -37,6 +89,7 @@ struct KeyMap {
 
 /* Display flushing */
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+    power.acquire(POWER_LOCK_RENDER);  // Held until the whole refresh is out (my_disp_monitor)
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
     tft.startWrite();
@@ -46,27 +99,70 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
     lv_disp_flush_ready(disp);
 }
 
+// LVGL calls this once a refresh cycle has been rendered and flushed
+void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+    power.release(POWER_LOCK_RENDER);
+}
+
 /* Touch Reading */
+// Latest sample (landscape, all fingers), consumed once per sample by the gesture recognizer
+static struct {
+    GesturePoint pts[Touch::MAX_POINTS];
+    uint8_t count;
+    uint32_t seq;
+    uint32_t ms;        // millis() when the sample was read
+} g_touch_frame;
+
 void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data) {
-    uint16_t touchX, touchY;
-    bool touched = touch.getTouch(&touchX, &touchY);
+    TouchPoint raw[Touch::MAX_POINTS];
+    uint8_t count = touch.getTouches(raw);
+    bool touched = count > 0;
+
+    static bool wasTouched = false;
+    static uint8_t releasedReads = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        // Map raw (Portrait) to Landscape
+        int16_t x = raw[i].y;
+        int16_t y = 320 - raw[i].x;
+
+        if(x < 0) x = 0;
+        if(x >= screenWidth) x = screenWidth - 1;
+        if(y < 0) y = 0;
+        if(y >= screenHeight) y = screenHeight - 1;
+
+        g_touch_frame.pts[i].x = x;
+        g_touch_frame.pts[i].y = y;
+    }
+    g_touch_frame.count = count;
+    g_touch_frame.ms = millis();
+    g_touch_frame.seq++;
+
+    eventLoop.onTouchRead(touched && !wasTouched);
 
     if (!touched) {
         data->state = LV_INDEV_STATE_REL;
+        power.release(POWER_LOCK_TOUCH);
+        // Released: stop polling once LVGL has finished with the release (a few more
+        // reads, no scroll or throw in progress); the touch interrupt resumes the read timer
+        if (releasedReads < TOUCH_RELEASE_GRACE_READS) releasedReads++;
+        if (eventLoop.touchInterrupt() && releasedReads >= TOUCH_RELEASE_GRACE_READS &&
+            lv_indev_get_scroll_obj(g_indev) == NULL) {
+            lv_timer_pause(indev_driver->read_timer);
+            eventLoop.rearmTouch();
+        }
     } else {
+        releasedReads = 0;
+        power.acquire(POWER_LOCK_TOUCH);
+        // Pre-wake the radio on touch-down so the button event's packet isn't held by modem sleep
+        if (!wasTouched) bleCombo.wake();
         data->state = LV_INDEV_STATE_PR;
-        
-        // Map raw (Portrait) to Landscape
-        data->point.x = touchY;
-        data->point.y = 320 - touchX;
-        
-        // Serial.printf("Touch: (%d, %d) Raw: (%d, %d)\n", data->point.x, data->point.y, touchX, touchY);
-
-        if(data->point.x < 0) data->point.x = 0;
-        if(data->point.x >= screenWidth) data->point.x = screenWidth - 1;
-        if(data->point.y < 0) data->point.y = 0;
-        if(data->point.y >= screenHeight) data->point.y = screenHeight - 1;
+
+        // LVGL only tracks the first finger
+        data->point.x = g_touch_frame.pts[0].x;
+        data->point.y = g_touch_frame.pts[0].y;
     }
+    wasTouched = touched;
 }
 
 /* I2C Scanner for Debug */
@@ -96,6 +192,7 @@ void init_styles() {
     lv_style_init(&style_scr);
     lv_style_set_bg_color(&style_scr, lv_color_hex(0x121212)); // Dark Grey
     lv_style_set_text_color(&style_scr, lv_color_white());
+    lv_style_set_text_font(&style_scr, FONT_SMALL);
 
     // Action Button Style (High Contrast)
     lv_style_init(&style_btn_action);
@@ -109,7 +206,7 @@ void init_styles() {
     lv_style_set_shadow_color(&style_btn_action, lv_color_hex(0x00E676)); // Green Glow
     lv_style_set_shadow_opa(&style_btn_action, LV_OPA_20);
     lv_style_set_text_color(&style_btn_action, lv_color_white()); // FORCE WHITE TEXT
-    lv_style_set_text_font(&style_btn_action, &lv_font_montserrat_14);
+    lv_style_set_text_font(&style_btn_action, FONT_BUTTON);
 
     // Nav Button Style (Same as Action buttons)
     lv_style_init(&style_btn_nav);
@@ -123,11 +220,11 @@ void init_styles() {
     lv_style_set_shadow_color(&style_btn_nav, lv_color_hex(0x00E676)); // Green Glow
     lv_style_set_shadow_opa(&style_btn_nav, LV_OPA_20);
     lv_style_set_text_color(&style_btn_nav, lv_color_white()); // FORCE WHITE TEXT
-    lv_style_set_text_font(&style_btn_nav, &lv_font_montserrat_14);
+    lv_style_set_text_font(&style_btn_nav, FONT_BUTTON);
 
     // Title Style
     lv_style_init(&style_title);
-    lv_style_set_text_font(&style_title, &lv_font_montserrat_14);
+    lv_style_set_text_font(&style_title, FONT_HEADER);
     lv_style_set_text_color(&style_title, lv_color_hex(0xFFFFFF));
 }
 
@@ -141,14 +238,14 @@ void btn_event_handler(lv_event_t *e) {
     if (k->repeat) {
         if (code == LV_EVENT_PRESSED) {
             bleCombo.k_press(k->key);
-            if (g_status_label) lv_label_set_text_fmt(g_status_label, "Holding: %s", k->label);
+            set_status_fmt("Holding: %s", k->label);
         } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
             bleCombo.k_release(k->key);
-            if (g_status_label) lv_label_set_text(g_status_label, "Released");
+            set_status("Released");
         }
     } else {
         if (code == LV_EVENT_CLICKED) {
-            if (g_status_label) lv_label_set_text_fmt(g_status_label, "Sent: %s", k->label);
+            set_status_fmt("Sent: %s", k->label);
 
             if (k->modifier == 1) {
                 bleCombo.k_press(KEY_LEFT_CTRL);
@@ -162,6 +259,72 @@ void btn_event_handler(lv_event_t *e) {
     }
 }
 
+/* Latency view: for a few seconds after a tap the status label shows RTT percentiles,
+   then the active transport's send counters (since the last loop stats print) */
+static const uint32_t LATENCY_VIEW_MS = 6000;
+static uint32_t g_latency_view_until = 0;
+
+bool show_latency_status() {
+    int32_t remaining = (int32_t)(g_latency_view_until - millis());
+    if (remaining <= 0) return false;
+    if (!g_status_label || !lv_obj_is_valid(g_status_label)) return false;
+
+    uint32_t p50, p95, p99;
+    if (remaining <= (int32_t)LATENCY_VIEW_MS / 2) {
+        Transport &t = bleCombo.transport();
+        set_status_fmt("%s %lu ok %lu err %lu us %lu B/s", t.name(),
+                       (unsigned long)t.stats().packets, (unsigned long)t.stats().errors,
+                       (unsigned long)t.avgSendUs(), (unsigned long)t.bytesPerSec());
+    } else if (!bleCombo.latency().percentiles(&p50, &p95, &p99)) {
+        set_status("RTT: no samples yet");
+    } else {
+        set_status_fmt("RTT %lu.%lu/%lu.%lu/%lu.%lu ms, %lu lost",
+                       p50 / 1000, (p50 / 100) % 10, p95 / 1000, (p95 / 100) % 10, p99 / 1000, (p99 / 100) % 10,
+                       (unsigned long)bleCombo.latency().lostPings());
+    }
+    lv_obj_set_style_text_color(g_status_label, lv_color_hex(0xFFC107), 0);
+    return true;
+}
+
+/* Status Label: tap shows RTT p50/p95/p99 and lost pings, then transport counters; long press cycles the network transport (UDP <-> TCP) */
+void status_label_event_handler(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_SHORT_CLICKED) {
+        g_latency_view_until = millis() + LATENCY_VIEW_MS;
+        show_latency_status();
+        return;
+    }
+    if (lv_event_get_code(e) != LV_EVENT_LONG_PRESSED) return;
+
+    TransportType next = (bleCombo.transportType() == TRANSPORT_UDP) ? TRANSPORT_TCP : TRANSPORT_UDP;
+    bleCombo.setTransport(next);
+
+    Transport &t = bleCombo.transport(next);
+    set_status_fmt("%s: %s", t.name(), t.connected() ? "ready" : "no receiver");
+}
+
+/* Header status timer, shared by both screens: only touches the label when the text changes */
+void status_timer_cb(lv_timer_t *t) {
+    if (show_latency_status()) return;
+    if (!g_status_label || !lv_obj_is_valid(g_status_label)) return;
+
+    if (bleCombo.isConnected()) {
+        if (!format_connection_status() && g_status_shown == g_status_conn) return;
+        set_status(g_status_conn);
+        lv_obj_set_style_text_color(g_status_label, lv_color_hex(0x4CAF50), 0);
+    } else {
+        static const char *const disconnected = "WiFi Disconnected";
+        if (g_status_shown == disconnected) return;
+        set_status(disconnected);
+        lv_obj_set_style_text_color(g_status_label, lv_color_hex(0xF44336), 0);
+    }
+}
+
+void attach_status_label(lv_obj_t *label) {
+    lv_obj_add_flag(label, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(label, status_label_event_handler, LV_EVENT_LONG_PRESSED, NULL);
+    lv_obj_add_event_cb(label, status_label_event_handler, LV_EVENT_SHORT_CLICKED, NULL);
+}
+
 /* Helper to Create Buttons */
 lv_obj_t* create_custom_btn(lv_obj_t *parent, const char *symbol, const char *text, int x, int y, int w, int h, KeyMap *km, lv_style_t *style) {
     lv_obj_t *btn = lv_btn_create(parent);
@@ -196,6 +359,7 @@ lv_obj_t* create_custom_btn(lv_obj_t *parent, const char *symbol, const char *te
 }
 
 void load_main_ui() {
+    power.acquire(POWER_LOCK_RENDER);  // Screen transition, released after its first refresh
     lv_obj_t *scr = lv_scr_act();
     lv_obj_clean(scr); // Clear splash
     lv_obj_add_style(scr, &style_scr, 0);
@@ -214,12 +378,14 @@ void load_main_ui() {
     lv_obj_t *logo_gs = lv_label_create(header);
     lv_label_set_text(logo_gs, "#4CAF50 GS# #FFFFFF PRO#");
     lv_label_set_recolor(logo_gs, true);
+    lv_obj_add_style(logo_gs, &style_title, 0);
     lv_obj_align(logo_gs, LV_ALIGN_LEFT_MID, 10, 0);
 
     // Status Label in Header
     g_status_label = lv_label_create(header);
-    lv_label_set_text(g_status_label, "WiFi...");
+    set_status("WiFi...");
     lv_obj_align(g_status_label, LV_ALIGN_CENTER, 0, 0);
+    attach_status_label(g_status_label);
 
     // Touchpad Button in Header (Right side, small)
     lv_obj_t *btn_mouse = lv_btn_create(header);
@@ -231,25 +397,13 @@ void load_main_ui() {
     lv_obj_t *lbl_mouse = lv_label_create(btn_mouse);
     lv_label_set_text(lbl_mouse, "MOUSE");
     lv_obj_set_style_text_color(lbl_mouse, lv_color_white(), 0);
+    lv_obj_set_style_text_font(lbl_mouse, FONT_SMALL, 0);
     lv_obj_center(lbl_mouse);
     lv_obj_clear_flag(lbl_mouse, LV_OBJ_FLAG_CLICKABLE);
 
     // Timer to update header status
     if (g_status_timer) lv_timer_del(g_status_timer); // Clean up old timer
-    g_status_timer = lv_timer_create([](lv_timer_t * t) {
-        bool connected = bleCombo.isConnected();
-
-        // Update Status Label
-        if (g_status_label && lv_obj_is_valid(g_status_label)) {
-             if(connected) {
-                lv_label_set_text_fmt(g_status_label, "WiFi: %s", WiFi.localIP().toString().c_str());
-                lv_obj_set_style_text_color(g_status_label, lv_color_hex(0x4CAF50), 0);
-            } else {
-                lv_label_set_text(g_status_label, "WiFi Disconnected");
-                lv_obj_set_style_text_color(g_status_label, lv_color_hex(0xF44336), 0);
-            }
-        }
-    }, 1000, NULL);
+    g_status_timer = lv_timer_create(status_timer_cb, 1000, NULL);
 
 
     // --- LEFT COLUMN: Game Actions ---
@@ -304,41 +458,55 @@ void load_main_ui() {
 }
 
 /* Touchpad UI */
-static struct {
-    int16_t last_x = -1;
-    int16_t last_y = -1;
-} touchpad_state;
+static GestureRecognizer touchpad_gestures;
+static uint32_t touchpad_last_seq = 0;
+static bool touchpad_absolute = TABLET_MODE_DEFAULT;   // Tablet mode: finger position = cursor position
+static uint16_t touchpad_abs_x = 0xFFFF, touchpad_abs_y = 0xFFFF;  // Last absolute position sent
+
+/* Absolute (tablet) mode: map the tablet area onto 0..65535, the receiver scales to its monitor */
+void touchpad_send_absolute(const GesturePoint &p) {
+    int32_t x = constrain(p.x - TABLET_AREA_X, 0, TABLET_AREA_W - 1);
+    int32_t y = constrain(p.y - TABLET_AREA_Y, 0, TABLET_AREA_H - 1);
+    uint16_t ax = (uint16_t)(x * 65535 / (TABLET_AREA_W - 1));
+    uint16_t ay = (uint16_t)(y * 65535 / (TABLET_AREA_H - 1));
+
+    if (ax == touchpad_abs_x && ay == touchpad_abs_y) return;
+    touchpad_abs_x = ax;
+    touchpad_abs_y = ay;
+    bleCombo.m_moveTo(ax, ay);
+}
 
 void touchpad_event_handler(lv_event_t *e) {
     lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t *touchpad = lv_event_get_target(e);
-
-    if (!bleCombo.isConnected()) return;
 
-    if (code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
-        lv_indev_t *indev = lv_indev_get_act();
-        lv_point_t point;
-        lv_indev_get_point(indev, &point);
+    if (code != LV_EVENT_PRESSED && code != LV_EVENT_PRESSING &&
+        code != LV_EVENT_RELEASED && code != LV_EVENT_PRESS_LOST) return;
 
-        if (touchpad_state.last_x != -1 && touchpad_state.last_y != -1) {
-            int16_t dx = point.x - touchpad_state.last_x;
-            int16_t dy = point.y - touchpad_state.last_y;
+    // LVGL can raise several events for one sample (PRESSED + PRESSING); feed each sample once
+    if (g_touch_frame.seq == touchpad_last_seq) return;
+    touchpad_last_seq = g_touch_frame.seq;
 
-            // Scale the movement for better control (multiplied by 3 for faster movement)
-            int8_t mouse_dx = constrain(dx * 3, -127, 127);
-            int8_t mouse_dy = constrain(dy * 3, -127, 127);
+    uint8_t count = (code == LV_EVENT_PRESS_LOST) ? 0 : g_touch_frame.count;
+    GestureEvent g = touchpad_gestures.update(g_touch_frame.pts, count, g_touch_frame.ms);
 
-            if (mouse_dx != 0 || mouse_dy != 0) {
-                bleCombo.m_move(mouse_dx, mouse_dy);
-            }
-        }
+    if (!bleCombo.isConnected()) return;
 
-        touchpad_state.last_x = point.x;
-        touchpad_state.last_y = point.y;
-    } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
-        touchpad_state.last_x = -1;
-        touchpad_state.last_y = -1;
+    // Tablet mode: one absolute position per single-finger sample, sent before any tap/click
+    if (touchpad_absolute && count == 1 && touchpad_gestures.singleFinger()) {
+        touchpad_send_absolute(g_touch_frame.pts[0]);
     }
+    sendGestureCommands(bleCombo, g, touchpad_absolute);
+}
+
+void touchpad_mode_event_handler(lv_event_t *e) {
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) return;
+
+    touchpad_absolute = !touchpad_absolute;
+    touchpad_abs_x = touchpad_abs_y = 0xFFFF;
+
+    lv_obj_t *label = lv_obj_get_child(lv_event_get_target(e), 0);
+    lv_label_set_text(label, touchpad_absolute ? "ABS" : "REL");
+    set_status(touchpad_absolute ? "Tablet Mode" : "Touchpad Mode");
 }
 
 void mouse_btn_event_handler(lv_event_t *e) {
@@ -349,10 +517,10 @@ void mouse_btn_event_handler(lv_event_t *e) {
 
     if (code == LV_EVENT_PRESSED) {
         bleCombo.m_press(*btn);
-        if (g_status_label) lv_label_set_text_fmt(g_status_label, "Mouse %s Pressed", (*btn == MOUSE_LEFT) ? "Left" : "Right");
+        set_status((*btn == MOUSE_LEFT) ? "Mouse Left Pressed" : "Mouse Right Pressed");
     } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
         bleCombo.m_release(*btn);
-        if (g_status_label) lv_label_set_text(g_status_label, "Mouse Released");
+        set_status("Mouse Released");
     }
 }
 
@@ -371,13 +539,14 @@ void touchpad_btn_event_handler(lv_event_t *e) {
 }
 
 void load_touchpad_ui() {
+    power.acquire(POWER_LOCK_RENDER);
     lv_obj_t *scr = lv_scr_act();
     lv_obj_clean(scr);
     lv_obj_add_style(scr, &style_scr, 0);
 
     // Reset touchpad state
-    touchpad_state.last_x = -1;
-    touchpad_state.last_y = -1;
+    touchpad_gestures.reset();
+    touchpad_abs_x = touchpad_abs_y = 0xFFFF;
 
     // Header Bar
     lv_obj_t *header = lv_obj_create(scr);
@@ -397,8 +566,9 @@ void load_touchpad_ui() {
 
     // Status Label in Header
     g_status_label = lv_label_create(header);
-    lv_label_set_text(g_status_label, "Touchpad Ready");
+    set_status("Touchpad Ready");
     lv_obj_align(g_status_label, LV_ALIGN_CENTER, 0, 0);
+    attach_status_label(g_status_label);
 
     // Back Button in Header (Right side, small)
     lv_obj_t *btn_back = lv_btn_create(header);
@@ -410,24 +580,13 @@ void load_touchpad_ui() {
     lv_obj_t *lbl_back = lv_label_create(btn_back);
     lv_label_set_text(lbl_back, LV_SYMBOL_LEFT " BACK");
     lv_obj_set_style_text_color(lbl_back, lv_color_white(), 0);
+    lv_obj_set_style_text_font(lbl_back, FONT_SMALL, 0);
     lv_obj_center(lbl_back);
     lv_obj_clear_flag(lbl_back, LV_OBJ_FLAG_CLICKABLE);
 
     // Timer to update header status
     if (g_status_timer) lv_timer_del(g_status_timer);
-    g_status_timer = lv_timer_create([](lv_timer_t * t) {
-        bool connected = bleCombo.isConnected();
-
-        if (g_status_label && lv_obj_is_valid(g_status_label)) {
-            if(connected) {
-                lv_label_set_text_fmt(g_status_label, "WiFi: %s", WiFi.localIP().toString().c_str());
-                lv_obj_set_style_text_color(g_status_label, lv_color_hex(0x4CAF50), 0);
-            } else {
-                lv_label_set_text(g_status_label, "WiFi Disconnected");
-                lv_obj_set_style_text_color(g_status_label, lv_color_hex(0xF44336), 0);
-            }
-        }
-    }, 1000, NULL);
+    g_status_timer = lv_timer_create(status_timer_cb, 1000, NULL);
 
     // Touchpad Area (Large touch-sensitive area)
     lv_obj_t *touchpad = lv_obj_create(scr);
@@ -442,7 +601,7 @@ void load_touchpad_ui() {
 
     // Touchpad Label
     lv_obj_t *touchpad_label = lv_label_create(touchpad);
-    lv_label_set_text(touchpad_label, "TOUCHPAD\nMove your finger here");
+    lv_label_set_text(touchpad_label, "TOUCHPAD\nTap to click, two fingers to scroll");
     lv_obj_set_style_text_align(touchpad_label, LV_TEXT_ALIGN_CENTER, 0);
     lv_obj_set_style_text_color(touchpad_label, lv_color_hex(0x888888), 0);
     lv_obj_center(touchpad_label);
@@ -479,27 +638,43 @@ void load_touchpad_ui() {
     lv_obj_set_style_text_color(lbl_right, lv_color_white(), 0);
     lv_obj_center(lbl_right);
     lv_obj_clear_flag(lbl_right, LV_OBJ_FLAG_CLICKABLE);
+
+    // Relative / Absolute (tablet) mode toggle (Bottom left)
+    lv_obj_t *btn_mode = lv_btn_create(scr);
+    lv_obj_set_size(btn_mode, 70, 60);
+    lv_obj_align(btn_mode, LV_ALIGN_BOTTOM_LEFT, 10, -10);
+    lv_obj_add_style(btn_mode, &style_btn_nav, 0);
+    lv_obj_add_event_cb(btn_mode, touchpad_mode_event_handler, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *lbl_mode = lv_label_create(btn_mode);
+    lv_label_set_text(lbl_mode, touchpad_absolute ? "ABS" : "REL");
+    lv_obj_set_style_text_color(lbl_mode, lv_color_white(), 0);
+    lv_obj_center(lbl_mode);
+    lv_obj_clear_flag(lbl_mode, LV_OBJ_FLAG_CLICKABLE);
 }
 
 void show_splash_screen() {
     lv_obj_t *scr = lv_scr_act();
     lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), 0);
 
-    // Big Logo
-    lv_obj_t *logo = lv_label_create(scr);
-    lv_label_set_text(logo, "#4CAF50 GS# #FFFFFF PRO#");
-    lv_label_set_recolor(logo, true);
-    // Scale text manually if needed or use a larger font if available. 
-    // Standard font is small, so we use zoom to make it huge
-    lv_obj_set_style_text_font(logo, &lv_font_montserrat_14, 0); 
-    lv_obj_set_style_transform_zoom(logo, 512, 0); // 2x scale
-    lv_obj_center(logo);
-
     lv_obj_t *sub = lv_label_create(scr);
     lv_label_set_text(sub, "Controller Loading...");
     lv_obj_set_style_text_color(sub, lv_color_hex(0x888888), 0);
     lv_obj_align(sub, LV_ALIGN_BOTTOM_MID, 0, -40);
 
+    // Render the LVGL part first, then stream the logo straight to the panel.
+    // No LVGL object covers the logo area, so it stays until the next screen is loaded.
+    lv_refr_now(NULL);
+    int16_t logo_x = (screenWidth - gspro_logo.width) / 2;
+    int16_t logo_y = 24;
+    power.acquire(POWER_LOCK_RENDER);
+    uint32_t push_us = 0;
+    uint32_t us = drawRleImage(tft, gspro_logo, logo_x, logo_y, &push_us);
+    power.release(POWER_LOCK_RENDER);
+    Serial.printf("Splash logo %dx%d (%lu bytes RLE) drawn in %lu us (decode %lu us, SPI %lu us)\n",
+                  gspro_logo.width, gspro_logo.height, (unsigned long)gspro_logo.dataLen, (unsigned long)us,
+                  (unsigned long)(us - push_us), (unsigned long)push_us);
+
     // One-shot timer to transition
     lv_timer_create([](lv_timer_t *t){
         load_main_ui();
@@ -507,6 +682,139 @@ void show_splash_screen() {
     }, 3000, NULL);
 }
 
+#ifdef ALLOC_CHECK
+/* Allocation check (esp32dev-alloccheck): replays touches and button presses through the
+   real event handlers into the loopback transport; any heap allocation on the way fails it */
+static lv_obj_t *alloc_pad, *alloc_key_hold, *alloc_key_tap, *alloc_mouse;
+static uint32_t alloc_clock_ms;
+static uint32_t alloc_packets;
+
+static void alloc_drain() {
+    LoopbackTransport &loop = (LoopbackTransport &)bleCombo.transport(TRANSPORT_LOOPBACK);
+    uint8_t frame[TRANSPORT_MAX_PACKET];
+    while (loop.read(frame, sizeof(frame))) alloc_packets++;
+}
+
+// Injects one sample the way my_touchpad_read + LVGL would deliver it
+static void alloc_touch(uint8_t count, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t dtMs) {
+    static uint8_t last = 0;
+    alloc_clock_ms += dtMs;
+
+    g_touch_frame.pts[0] = {x0, y0};
+    g_touch_frame.pts[1] = {x1, y1};
+    g_touch_frame.count = count;
+    g_touch_frame.ms = alloc_clock_ms;
+    g_touch_frame.seq++;
+
+    lv_event_code_t code = count ? (last ? LV_EVENT_PRESSING : LV_EVENT_PRESSED) : LV_EVENT_RELEASED;
+    last = count;
+    lv_event_send(alloc_pad, code, NULL);
+    alloc_drain();
+}
+
+static void alloc_replay() {
+    alloc_clock_ms += 1000;  // Keep runs apart so the first tap is not a double tap
+
+    // Tap
+    alloc_touch(1, 200, 150, 0, 0, 0);
+    alloc_touch(0, 0, 0, 0, 0, 60);
+
+    // One-finger move
+    for (int i = 0; i < 12; i++) alloc_touch(1, 150 + i * 8, 120 + i * 4, 0, 0, 16);
+    alloc_touch(0, 0, 0, 0, 0, 16);
+
+    // Two-finger scroll
+    alloc_clock_ms += 500;
+    for (int i = 0; i < 12; i++) alloc_touch(2, 150, 100 + i * 10, 250, 100 + i * 10, 16);
+    alloc_touch(0, 0, 0, 0, 0, 16);
+
+    // Buttons: held key, clicked key, mouse button
+    lv_event_send(alloc_key_hold, LV_EVENT_PRESSED, NULL);
+    lv_event_send(alloc_key_hold, LV_EVENT_RELEASED, NULL);
+    lv_event_send(alloc_key_tap, LV_EVENT_CLICKED, NULL);
+    lv_event_send(alloc_mouse, LV_EVENT_PRESSED, NULL);
+    lv_event_send(alloc_mouse, LV_EVENT_RELEASED, NULL);
+    alloc_drain();
+
+    // Status refresh after the button messages, plus the network poll
+    status_timer_cb(NULL);
+    bleCombo.poll();
+}
+
+void run_alloc_check() {
+    static KeyMap kmHold = {"Hold", 'w', 0, true};
+    static KeyMap kmTap = {"Tap", 'p', 0, false};
+    static uint8_t mouse_left = MOUSE_LEFT;
+
+    bleCombo.setTransport(TRANSPORT_LOOPBACK);
+    load_touchpad_ui();
+
+    // Hidden stand-ins carrying the production handlers
+    lv_obj_t *scr = lv_scr_act();
+    alloc_pad = lv_obj_create(scr);
+    alloc_key_hold = lv_obj_create(scr);
+    alloc_key_tap = lv_obj_create(scr);
+    alloc_mouse = lv_obj_create(scr);
+    lv_obj_add_event_cb(alloc_pad, touchpad_event_handler, LV_EVENT_ALL, NULL);
+    lv_obj_add_event_cb(alloc_key_hold, btn_event_handler, LV_EVENT_ALL, &kmHold);
+    lv_obj_add_event_cb(alloc_key_tap, btn_event_handler, LV_EVENT_ALL, &kmTap);
+    lv_obj_add_event_cb(alloc_mouse, mouse_btn_event_handler, LV_EVENT_ALL, &mouse_left);
+    lv_obj_add_flag(alloc_pad, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(alloc_key_hold, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(alloc_key_tap, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(alloc_mouse, LV_OBJ_FLAG_HIDDEN);
+
+    alloc_clock_ms = millis();
+    alloc_packets = 0;
+    bool pass = runAllocCheck("touch input", alloc_replay);
+    Serial.printf("  %lu packets over 2 replays\n", (unsigned long)alloc_packets);
+
+    bleCombo.setTransport(DEFAULT_TRANSPORT);
+    load_main_ui();
+    set_status(pass ? "Alloc check PASS" : "Alloc check FAIL");
+}
+#endif
+
+/* Main loop scheduling */
+void on_wifi_event(arduino_event_id_t event) {
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP || event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        eventLoop.notify(WAKE_WIFI);
+    }
+}
+
+void print_loop_stats(lv_timer_t *t) {
+    const EventLoopStats &s = eventLoop.stats();
+    uint32_t rate = eventLoop.wakeupsPerSec10();
+    Serial.printf("Loop: %lu.%lu wakeups/s (touch %lu, net %lu), touch->input %lu us (max %lu us, %lu touches)\n",
+                  (unsigned long)(rate / 10), (unsigned long)(rate % 10),
+                  (unsigned long)s.touchWakes, (unsigned long)s.netWakes,
+                  (unsigned long)s.lastInputUs, (unsigned long)s.maxInputUs, (unsigned long)s.inputs);
+    eventLoop.resetStats();
+
+    PowerStats p = power.stats();
+    uint32_t total = (uint32_t)((p.maxUs + p.idleUs) / 1000);
+    if (total) {
+        Serial.printf("CPU: %u MHz %lu%%, %u MHz%s %lu%%, %lu wakes, wake->max clock %lu us (max %lu us)\n",
+                      CPU_FREQ_MAX_MHZ, (unsigned long)(p.maxUs / 10 / total),
+                      CPU_FREQ_IDLE_MHZ, power.lightSleep() ? "/sleep" : "", (unsigned long)(p.idleUs / 10 / total),
+                      (unsigned long)p.switches, (unsigned long)p.lastWakeUs, (unsigned long)p.maxWakeUs);
+    }
+    power.resetStats();
+
+    // Per-backend send counters, to compare transports at a venue (switch with a long press)
+    for (uint8_t i = 0; i < TRANSPORT_COUNT; i++) {
+        Transport &tr = bleCombo.transport((TransportType)i);
+        const TransportStats &ts = tr.stats();
+        if (ts.packets || ts.errors) {
+            Serial.printf("Transport %s: %lu sent, %lu failed, avg %lu us (max %lu us), %lu B/s\n",
+                          tr.name(), (unsigned long)ts.packets, (unsigned long)ts.errors,
+                          (unsigned long)tr.avgSendUs(), (unsigned long)ts.maxSendUs,
+                          (unsigned long)tr.bytesPerSec());
+        }
+        tr.resetStats();
+    }
+}
+
 void setup() {
     Serial.begin(115200);
     delay(500);
@@ -528,6 +836,9 @@ void setup() {
     digitalWrite(23, HIGH);
 
     bleCombo.begin();
+#ifdef SEND_BENCHMARK
+    runSendBenchmark(bleCombo, 2000);
+#endif
     scanI2C();
 
     lv_init();
@@ -538,6 +849,7 @@ void setup() {
     disp_drv.hor_res = screenWidth;
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
+    disp_drv.monitor_cb = my_disp_monitor;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
 
@@ -545,15 +857,59 @@ void setup() {
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = my_touchpad_read;
-    lv_indev_drv_register(&indev_drv);
+    g_indev = lv_indev_drv_register(&indev_drv);
+
+    eventLoop.begin(TOUCH_INT_PIN);
+    WiFi.onEvent(on_wifi_event);
+#if CPU_FREQ_IDLE_MHZ
+    power.begin(CPU_FREQ_MAX_MHZ, CPU_FREQ_IDLE_MHZ, CPU_LIGHT_SLEEP, POWER_IDLE_HOLDOFF_MS);
+    if (power.lightSleep()) eventLoop.enableLightSleepWake();
+#endif
+#if LOOP_STATS_INTERVAL_MS
+    lv_timer_create(print_loop_stats, LOOP_STATS_INTERVAL_MS, NULL);
+#endif
 
     init_styles();
     show_splash_screen();
+#ifdef ALLOC_CHECK
+    // Once the main UI is up (splash hands over after 3 s)
+    lv_timer_create([](lv_timer_t *t) {
+        lv_timer_del(t);
+        run_alloc_check();
+    }, 3500, NULL);
+#endif
     
     Serial.println("System Ready");
 }
 
 void loop() {
-    lv_timer_handler();
-    delay(5);
+    bleCombo.poll();                        // First, so a pong that woke us is timestamped before any redraw
+    uint32_t idleMs = lv_timer_handler();   // Runs due timers, returns time until the next one
+
+    // Full clock while the WiFi task is still transmitting what was just sent (or handing us a reply)
+    uint32_t sinceSendMs = millis() - bleCombo.lastSendMs();
+    if (sinceSendMs < POWER_NET_HOLD_MS) {
+        power.acquire(POWER_LOCK_NETWORK);
+        if (idleMs > POWER_NET_HOLD_MS - sinceSendMs) idleMs = POWER_NET_HOLD_MS - sinceSendMs;
+    } else {
+        power.release(POWER_LOCK_NETWORK);
+    }
+
+    // Drop to the idle clock once nothing has needed full speed for the hold-off
+    uint32_t clockMs = power.update();
+    if (idleMs > clockMs) idleMs = clockMs;
+
+    // Sleep until that deadline unless input arrives first
+    Transport &net = bleCombo.transport();
+    eventLoop.watchSocket(net.fd(), net.wantsWrite());
+    uint32_t wake = eventLoop.wait(idleMs);
+
+    if (wake & WAKE_NET) power.acquire(POWER_LOCK_NETWORK);  // Released once poll() has drained it
+    if (wake & WAKE_TOUCH) {
+        power.acquire(POWER_LOCK_TOUCH, eventLoop.touchIrqUs());
+        // Read the touch now rather than at the next read period
+        lv_timer_resume(g_indev->driver->read_timer);
+        lv_timer_ready(g_indev->driver->read_timer);
+    }
+    if ((wake & WAKE_WIFI) && g_status_timer) lv_timer_ready(g_status_timer);
 }
@@ -0,0 +1,193 @@
+// Host test (pio test -e native): replays touch samples through the gesture
+// recognizer and the command encoder into the loopback transport and fails on
+// any heap allocation. malloc/calloc/realloc are wrapped at link time
+// (-Wl,--wrap in platformio.ini), operator new/delete are replaced below.
+
+#include <stdlib.h>
+#include <new>
+#include <unity.h>
+
+#include "CommandEncoder.h"
+#include "GestureCommands.h"
+
+/* Counting allocator */
+static bool g_armed = false;
+static uint32_t g_allocs = 0;
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    if (g_armed) g_allocs++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    if (g_armed) g_allocs++;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    if (g_armed) g_allocs++;
+    return __real_realloc(ptr, size);
+}
+}
+
+void *operator new(size_t size) {
+    if (g_armed) g_allocs++;
+    void *p = __real_malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+static void arm() {
+    g_allocs = 0;
+    g_armed = true;
+}
+
+static uint32_t disarm() {
+    g_armed = false;
+    return g_allocs;
+}
+
+/* Fake clock for TransportBase.h */
+static uint32_t g_nowUs = 0;
+
+uint32_t micros() { return g_nowUs; }
+uint32_t millis() { return g_nowUs / 1000; }
+
+/* Replay: recognizer -> encoder -> loopback, drained after every sample like the receiver would */
+static GestureRecognizer g_gestures;
+static LoopbackTransport g_loop;
+static CommandEncoder g_encoder(&g_loop);
+static uint32_t g_frames[CMD_PONG + 1];
+static uint8_t g_last[TRANSPORT_MAX_PACKET];
+static size_t g_lastLen = 0;
+
+static void drain() {
+    size_t n;
+    while ((n = g_loop.read(g_last, sizeof(g_last))) > 0) {
+        if (g_last[0] <= CMD_PONG) g_frames[g_last[0]]++;
+        g_lastLen = n;
+    }
+}
+
+static void sample(uint32_t afterMs, uint8_t count, int16_t x0, int16_t y0, int16_t x1 = 0, int16_t y1 = 0) {
+    g_nowUs += afterMs * 1000;
+    GesturePoint pts[2] = {{x0, y0}, {x1, y1}};
+    GestureEvent g = g_gestures.update(pts, count, millis());
+    sendGestureCommands(g_encoder, g, false);
+    drain();
+}
+
+static void replayTouchInput() {
+    // Tap
+    sample(100, 1, 200, 150);
+    sample(16, 1, 201, 150);
+    sample(16, 0, 0, 0);
+
+    // Double tap, then drag with the second touch
+    sample(500, 1, 200, 150);
+    sample(16, 0, 0, 0);
+    sample(100, 1, 202, 151);
+    for (int i = 1; i <= 20; i++) sample(16, 1, 202 + i * 4, 151 + i * 2);
+    sample(16, 0, 0, 0);
+
+    // One-finger move
+    sample(500, 1, 100, 100);
+    for (int i = 1; i <= 40; i++) sample(16, 1, 100 + i * 5, 100 - i);
+    sample(16, 0, 0, 0);
+
+    // Two-finger tap
+    sample(500, 2, 150, 150, 250, 150);
+    sample(16, 2, 151, 150, 250, 151);
+    sample(16, 0, 0, 0);
+
+    // Two-finger scroll
+    sample(500, 2, 150, 100, 250, 100);
+    for (int i = 1; i <= 30; i++) sample(16, 2, 150, 100 + i * 4, 250, 100 + i * 4);
+    sample(16, 0, 0, 0);
+
+    // Pinch (spread)
+    sample(500, 2, 200, 150, 240, 150);
+    for (int i = 1; i <= 30; i++) sample(16, 2, 200 - i * 3, 150, 240 + i * 3, 150);
+    sample(16, 0, 0, 0);
+
+    // Tablet mode positions and hardware-style buttons
+    for (int i = 0; i < 10; i++) {
+        g_encoder.m_moveTo(i * 6000, 65535 - i * 6000);
+        drain();
+    }
+    g_encoder.m_press(MOUSE_LEFT);
+    g_encoder.m_release(MOUSE_LEFT);
+    g_encoder.k_write(KEY_F5);
+    drain();
+}
+
+void setUp() {
+    g_gestures.reset();
+    g_loop.begin(0, 0);
+    for (uint32_t &n : g_frames) n = 0;
+    g_lastLen = 0;
+}
+
+void tearDown() {}
+
+void test_counter_sees_allocations() {
+    // Guards against a harness that silently counts nothing
+    arm();
+    int *volatile p = new int(1);
+    void *volatile m = malloc(16);
+    uint32_t allocs = disarm();
+    delete p;
+    free(m);
+    TEST_ASSERT_EQUAL_UINT32(2, allocs);
+}
+
+void test_touch_replay_allocates_nothing() {
+    arm();
+    replayTouchInput();
+    uint32_t allocs = disarm();
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, allocs, "heap allocation on the input path");
+
+    // Every gesture must actually have produced its commands
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_MOUSE_MOVE]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_MOUSE_CLICK]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_MOUSE_PRESS]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_MOUSE_RELEASE]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_MOUSE_WHEEL]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_KEY_PRESS]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, g_frames[CMD_KEY_RELEASE]);
+    TEST_ASSERT_EQUAL_UINT32(10, g_frames[CMD_MOUSE_ABS]);
+    TEST_ASSERT_EQUAL_UINT32(0, g_loop.stats().errors);
+}
+
+void test_frame_carries_timestamp_trailer() {
+    g_nowUs = 0x12345678;
+    g_encoder.m_move(-3, 4);
+    drain();
+
+    TEST_ASSERT_EQUAL_UINT32(1 + 2 + CMD_TIMESTAMP_LEN, g_lastLen);
+    TEST_ASSERT_EQUAL_UINT8(CMD_MOUSE_MOVE, g_last[0]);
+    TEST_ASSERT_EQUAL_INT8(-3, (int8_t)g_last[1]);
+    TEST_ASSERT_EQUAL_INT8(4, (int8_t)g_last[2]);
+    uint8_t ts[CMD_TIMESTAMP_LEN] = {0x12, 0x34, 0x56, 0x78};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ts, g_last + 3, CMD_TIMESTAMP_LEN);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counter_sees_allocations);
+    RUN_TEST(test_touch_replay_allocates_nothing);
+    RUN_TEST(test_frame_carries_timestamp_trailer);
+    return UNITY_END();
+}